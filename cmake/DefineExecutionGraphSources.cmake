@@ -23,6 +23,7 @@ function(include_all_source_ExecutionGraph
         ${ExecutionGraph_ROOT_DIR}/src/LogicNode.cpp
 
         ${ExecutionGraph_ROOT_DIR}/src/FileSystem.cpp
+        ${ExecutionGraph_ROOT_DIR}/src/CpuTopology.cpp
 
         ${ExecutionGraph_ROOT_DIR}/src/FileMapper.cpp
 
@@ -44,21 +45,33 @@ function(include_all_source_ExecutionGraph
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/MyMatrixTypeDefs.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/Platform.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/SfinaeMacros.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/SmallVector.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/TypeDefs.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/Identifier.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/IObjectID.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/Factory.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/FileSystem.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/ForkJoinPool.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/WorkStealingThreadPool.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/BoundedTaskQueue.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/PriorityTaskQueue.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/CpuTopology.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/common/NumaThreadPool.hpp
 
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/nodes/LogicCommon.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/nodes/LogicSocket.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/nodes/LogicSocketDefaultTypes.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/nodes/LogicSocketValueArena.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/nodes/LogicNode.hpp
         
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/graphs/ExecutionTree.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/graphs/NodeSlotMap.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/graphs/ReachabilityIndex.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/graphs/StronglyConnectedComponents.hpp
 
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/serialization/ExecutionGraphSerializer.hpp
         ${ExecutionGraph_ROOT_DIR}/include/executionGraph/serialization/FileMapper.hpp
+        ${ExecutionGraph_ROOT_DIR}/include/executionGraph/serialization/SocketValueSnapshot.hpp
 
         ${ExecutionGraph_CONFIG_FILE}
         PARENT_SCOPE
@@ -16,6 +16,7 @@
 #include <unordered_set>
 #include <rttr/type>
 #include <executionGraph/common/IObjectID.hpp>
+#include <executionGraph/common/PriorityTaskQueue.hpp>
 #include "executionGraph/common/FileSystem.hpp"
 #include "executionGraphGui/backend/Backend.hpp"
 #include "executionGraphGui/common/Assert.hpp"
@@ -43,4 +44,11 @@ public:
 
     //! Handle the `request` by resolving the response promise `response`.
     virtual void handleRequest(const Request& request, ResponsePromise& response) = 0;
+
+    //! Get the scheduling of `request` if it is queued for dispatch.
+    //! Interactive handlers should return a high priority, bulk work a low one.
+    virtual executionGraph::TaskSchedule getSchedule(const Request& request) const
+    {
+        return {};
+    }
 };
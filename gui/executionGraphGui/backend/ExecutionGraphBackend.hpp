@@ -255,6 +255,7 @@ void ExecutionGraphBackend::addNode(const Id& graphId,
 
         try
         {
+            typename NodeBaseType::MemoryResourceScope scope(graphL->getNodeMemoryResource());
             auto n = serializer.read(type, id);
             node   = graphL->addNode(std::move(n));
         }
@@ -308,9 +309,14 @@ void ExecutionGraphBackend::addConnection(const Id& graphId,
         auto graphL = graph->wlock();
         try
         {
-            EXECGRAPHGUI_THROW_BAD_REQUEST_IF(checkForCycles, "Checking cycles not yet implemented!");
-
-            if(isWriteLink)
+            executionGraph::CycleDescription cycle;
+            if(checkForCycles &&
+               graphL->wouldCreateCycle({outNodeId, outSocketIdx, inNodeId, inSocketIdx, isWriteLink}, &cycle))
+            {
+                // Do not add the connection, report the cycle.
+                cycles.emplace_back(std::move(cycle));
+            }
+            else if(isWriteLink)
             {
                 graphL->addWriteLink(outNodeId, outSocketIdx, inNodeId, inSocketIdx);
             }
@@ -232,6 +232,12 @@ FileBrowserRequestHandler::requestTargets() const
     return m_functionMap.keys();
 }
 
+//! Directory scans are bulk work.
+executionGraph::TaskSchedule FileBrowserRequestHandler::getSchedule(const Request& request) const
+{
+    return executionGraph::TaskSchedule(executionGraph::TaskPriority::Low);
+}
+
 //! Handle the request.
 void FileBrowserRequestHandler::handleRequest(const Request& request,
                                               ResponsePromise& response)
@@ -47,6 +47,7 @@ public:
 
     void handleRequest(const Request& request, ResponsePromise& response) override;
     const std::unordered_set<HandlerKey>& requestTargets() const override;
+    executionGraph::TaskSchedule getSchedule(const Request& request) const override;
 
 private:
     void handle(const Request& request, ResponsePromise& response);
@@ -53,6 +53,12 @@ GraphManipulationRequestHandler::requestTargets() const
     return m_functionMap.keys();
 }
 
+//! Graph edits are interactive and overtake queued bulk requests.
+executionGraph::TaskSchedule GraphManipulationRequestHandler::getSchedule(const Request& request) const
+{
+    return executionGraph::TaskSchedule(executionGraph::TaskPriority::High);
+}
+
 //! Handle the request.
 void GraphManipulationRequestHandler::handleRequest(const Request& request,
                                                     ResponsePromise& response)
@@ -139,8 +145,46 @@ void GraphManipulationRequestHandler::handleAddConnection(const Request& request
 
     Id graphID{connectionReq->graphId()->str()};
 
-    auto responseCreator = [](auto& graph, auto&& cycles) {
+    // Callback to create the response
+    auto responseCreator = [&response](auto& graph, auto&& cycles) {
+        if(cycles.empty())
+        {
+            // Connection added.
+            response.setReady();
+            return;
+        }
+
+        using Allocator = ResponsePromise::Allocator;
+        AllocatorProxyFlatBuffer<Allocator> allocator(response.getAllocator());
+        flatbuffers::FlatBufferBuilder builder(512, &allocator);
+
+        // Serialize all cycles
+        std::vector<fl::Offset<s::CycleDescription>> cycleOffsets;
+        std::vector<executionGraph::serialization::SocketLinkDescription> cyclePath;
+        for(auto& cycle : cycles)
+        {
+            cyclePath.clear();
+            for(auto& link : cycle)
+            {
+                cyclePath.emplace_back(link.m_outNodeId,
+                                       link.m_outSocketIdx,
+                                       link.m_inNodeId,
+                                       link.m_inSocketIdx,
+                                       link.m_isWriteLink);
+            }
+            cycleOffsets.emplace_back(s::CreateCycleDescriptionDirect(builder, &cyclePath));
+        }
+        auto cyclesOffset = builder.CreateVector(cycleOffsets);
+
+        s::AddConnectionResponseBuilder addResponse(builder);
+        addResponse.add_cycles(cyclesOffset);
+        auto resOff = addResponse.Finish();
+        builder.Finish(resOff);
 
+        // Set the response.
+        response.setReady(ResponsePromise::Payload{releaseIntoBinaryBuffer(std::move(allocator),
+                                                                           builder),
+                                                   "application/octet-stream"});
     };
 
     // Execute the request
@@ -153,9 +197,6 @@ void GraphManipulationRequestHandler::handleAddConnection(const Request& request
                              socketLink->isWriteLink(),
                              connectionReq->checkForCycles(),
                              responseCreator);
-
-    // Set the response.
-    response.setReady();
 }
 
 //! Handle the operation of removing a connection.
@@ -51,6 +51,7 @@ public:
 
     void handleRequest(const Request& request, ResponsePromise& response) override;
     const std::unordered_set<HandlerKey>& requestTargets() const override;
+    executionGraph::TaskSchedule getSchedule(const Request& request) const override;
 
 private:
     void handleAddNode(const Request& request,
@@ -50,6 +50,12 @@ const std::unordered_set<GraphSerializationRequestHandler::HandlerKey>& GraphSer
     return m_functionMap.keys();
 }
 
+//! Saving and loading graphs is bulk work.
+executionGraph::TaskSchedule GraphSerializationRequestHandler::getSchedule(const Request& request) const
+{
+    return executionGraph::TaskSchedule(executionGraph::TaskPriority::Low);
+}
+
 //! Handle the operation of adding a graph.
 void GraphSerializationRequestHandler::handleRequest(const Request& request,
                                                      ResponsePromise& response)
@@ -88,6 +88,10 @@ namespace details
     The THandler::handleRequest function needs to be thread-safe because it can be called
     as it will be called on the same instance on possible multiple threads.
 
+    If `useThreadsForDispatch` is used, queued requests are scheduled by
+    `THandler::getSchedule(request)` (priority class and deadline),
+    such that e.g. interactive requests overtake queued bulk requests.
+
     @date Sun Feb 18 2018
     @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
  */
@@ -134,9 +138,10 @@ public:
             if constexpr(useThreadsForDispatch)
             {
                 // Run the handler in the thread pool.
-                m_pool.getQueue()->emplace(handler,
-                                           std::move(request),
-                                           std::move(response));
+                m_pool.getQueue()->emplaceScheduled(handler->getSchedule(request),
+                                                    handler,
+                                                    std::move(request),
+                                                    std::move(response));
             }
             else
             {
@@ -253,7 +258,7 @@ private:
         using Consumer = typename executionGraph::ThreadPool<Task<false>>::Consumer;
     };
     using Pool = meta::if_<meta::bool_<useThreadsForDispatch>,
-                           executionGraph::ThreadPool<Task<true>>,
+                           executionGraph::ThreadPool<Task<true>, executionGraph::PriorityTaskQueue<Task<true>>>,
                            NoPool>;
     Pool m_pool{1};  //! One seperate thread will handle all messages for this dispatcher.
 };
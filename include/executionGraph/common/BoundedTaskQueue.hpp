@@ -0,0 +1,457 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include "executionGraph/common/AccessMacros.hpp"
+#include "executionGraph/common/Assert.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        A bounded, thread-safe multi-producer/multi-consumer task queue
+        with the same interface as `TaskQueue`.
+
+        The tasks are stored in a ring buffer of fixed capacity (rounded up to a power of two).
+        Each slot has a sequence number which tells producers and consumers if the slot
+        is free or filled, such that pushing and popping is lock-free. Only a producer
+        on a full queue or a consumer on an empty queue takes a mutex to sleep,
+        a producer or consumer only notifies if somebody sleeps.
+
+        Backpressure: `tryEmplace` fails on a full queue, `emplace` blocks until
+        there is space (or the queue is closed).
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename TTask>
+    class BoundedTaskQueue
+    {
+        //! No move/copy allowed!
+        EXECGRAPH_DISALLOW_COPY_AND_MOVE(BoundedTaskQueue)
+
+    public:
+        using Task = TTask;
+        static_assert(std::is_move_constructible_v<Task>);
+
+        //! Default capacity of the queue.
+        static constexpr std::size_t defaultCapacity = 1024;
+
+    private:
+        //! Size for padding to avoid false sharing.
+        static constexpr std::size_t cacheLineSize = 64;
+
+        struct Cell
+        {
+            std::atomic<std::size_t> m_sequence;                         //!< Sequence number of this slot.
+            std::aligned_storage_t<sizeof(Task), alignof(Task)> m_task;  //!< Storage for the task.
+        };
+
+    public:
+        BoundedTaskQueue(std::size_t capacity = defaultCapacity)
+            : m_capacity(roundUpToPowerOfTwo(capacity))
+            , m_mask(m_capacity - 1)
+            , m_cells(std::make_unique<Cell[]>(m_capacity))
+        {
+            for(std::size_t i = 0; i < m_capacity; ++i)
+            {
+                m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        virtual ~BoundedTaskQueue()
+        {
+            while(tryPopImpl())
+            {
+            }
+        }
+
+    public:
+        //! Get the capacity of the queue.
+        std::size_t getCapacity() const { return m_capacity; }
+
+        //! Get the approximate number of tasks in the queue.
+        std::size_t size() const
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+
+        //! Emplace a task if the queue is not full.
+        //! Returns `false` if the queue is full (the arguments are not consumed).
+        template<typename... Args>
+        bool tryEmplace(Args&&... args)
+        {
+            if(!tryPushImpl(std::forward<Args>(args)...))
+            {
+                return false;
+            }
+            notifyConsumers(false);
+            return true;
+        }
+
+        //! Emplace a task. Blocks while the queue is full.
+        //! Returns `false` if the queue is closed and full (the task is dropped).
+        template<typename... Args>
+        bool emplace(Args&&... args)
+        {
+            if(!pushImpl(std::forward<Args>(args)...))
+            {
+                return false;
+            }
+            notifyConsumers(false);
+            return true;
+        }
+
+        //! Emplace all tasks in `range` with one notification
+        //! (tasks are moved out of `range` if it is an rvalue).
+        //! Blocks while the queue is full.
+        //! Returns the number of emplaced tasks (less than the size of `range` if the queue has been closed).
+        template<typename TRange>
+        std::size_t emplaceBulk(TRange&& range)
+        {
+            std::size_t count = 0;
+            for(auto&& task : range)
+            {
+                bool pushed;
+                if constexpr(std::is_rvalue_reference_v<TRange&&>)
+                {
+                    pushed = pushImpl(std::move(task));
+                }
+                else
+                {
+                    pushed = pushImpl(task);
+                }
+                if(!pushed)
+                {
+                    break;
+                }
+                ++count;
+            }
+
+            if(count != 0)
+            {
+                notifyConsumers(count > 1);
+            }
+            return count;
+        }
+
+        //! Get a next task if there is any.
+        std::optional<Task> tryPop()
+        {
+            if(m_closed.load())
+            {
+                return {};
+            }
+            auto task = tryPopImpl();
+            if(task)
+            {
+                notifyProducers();
+            }
+            return task;
+        }
+
+        //! Get a next task. Blocks until a task is available or the queue is closed.
+        std::optional<Task> popBlocking()
+        {
+            return popOrStop([]() { return false; });
+        }
+
+        //! Get a next task. Blocks until a task is available, the queue is closed
+        //! or `stop()` returns `true`. No task is returned once `stop()` returns `true`,
+        //! even if tasks are queued. The predicate `stop` is re-evaluated after `notifyAll()`.
+        template<typename TStop>
+        std::optional<Task> popOrStop(TStop&& stop)
+        {
+            std::optional<Task> task;
+            if(stop())
+            {
+                return task;  // Stop before any further task.
+            }
+            task = tryPop();
+            if(task || m_closed.load())
+            {
+                return task;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            waitBegin(m_nWaitingConsumers);
+            m_notEmpty.wait(lock, [&]() { return m_closed.load() || stop() || (task = tryPopImpl()); });
+            --m_nWaitingConsumers;
+            lock.unlock();
+
+            if(task)
+            {
+                notifyProducers();
+            }
+            return task;
+        }
+
+        //! Get a next task. Block at most for `blockTime`.
+        std::optional<Task> pop(const std::chrono::milliseconds blockTime = std::chrono::milliseconds(200))
+        {
+            std::optional<Task> task = tryPop();
+            if(task || m_closed.load())
+            {
+                return task;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            waitBegin(m_nWaitingConsumers);
+            m_notEmpty.wait_for(lock, blockTime, [&]() { return m_closed.load() || (task = tryPopImpl()); });
+            --m_nWaitingConsumers;
+            lock.unlock();
+
+            if(task)
+            {
+                notifyProducers();
+            }
+            return task;
+        }
+
+        //! Append at most `maxCount` tasks to `tasks`.
+        //! Blocks until a task is available or the queue is closed.
+        //! Returns the number of popped tasks.
+        std::size_t popBulk(std::vector<Task>& tasks, std::size_t maxCount)
+        {
+            if(maxCount == 0)
+            {
+                return 0;
+            }
+            auto task = popBlocking();
+            if(!task)
+            {
+                return 0;
+            }
+            tasks.emplace_back(std::move(*task));
+
+            std::size_t count = 1;
+            for(; count < maxCount; ++count)
+            {
+                task = tryPopImpl();
+                if(!task)
+                {
+                    break;
+                }
+                tasks.emplace_back(std::move(*task));
+            }
+            if(count > 1)
+            {
+                notifyProducers();
+            }
+            return count;
+        }
+
+        //! Get at most `maxCount` tasks (see `popBulk(tasks, maxCount)`).
+        std::vector<Task> popBulk(std::size_t maxCount)
+        {
+            std::vector<Task> tasks;
+            popBulk(tasks, maxCount);
+            return tasks;
+        }
+
+        //! Close the queue and wake up all waiting consumers and producers.
+        void close()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                m_closed = true;
+            }
+            m_notEmpty.notify_all();
+            m_notFull.notify_all();
+        }
+
+        //! Open the queue again (after `close()`).
+        void open()
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            m_closed = false;
+        }
+
+        //! Check if the queue is closed.
+        bool isClosed() const { return m_closed.load(); }
+
+        //! Wake up all waiting consumers, such that they re-evaluate their stop predicate.
+        void notifyAll()
+        {
+            // Lock to not miss a consumer which is just about to wait.
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+            }
+            m_notEmpty.notify_all();
+        }
+
+    private:
+        static std::size_t roundUpToPowerOfTwo(std::size_t n)
+        {
+            std::size_t p = 2;
+            while(p < n)
+            {
+                p <<= 1;
+            }
+            return p;
+        }
+
+        //! Lock-free push of a task. Returns `false` if the queue is full.
+        template<typename... Args>
+        bool tryPushImpl(Args&&... args)
+        {
+            std::size_t pos = m_tail.load(std::memory_order_relaxed);
+            while(true)
+            {
+                Cell& cell                = m_cells[pos & m_mask];
+                const std::size_t seq     = cell.m_sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if(diff == 0)
+                {
+                    // The slot is free: claim it.
+                    if(m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        new(&cell.m_task) Task(std::forward<Args>(args)...);
+                        cell.m_sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    // The slot is still filled: queue is full.
+                    return false;
+                }
+                else
+                {
+                    // Another producer claimed the slot.
+                    pos = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        //! Lock-free pop of a task. Returns no task if the queue is empty.
+        std::optional<Task> tryPopImpl()
+        {
+            std::size_t pos = m_head.load(std::memory_order_relaxed);
+            while(true)
+            {
+                Cell& cell                = m_cells[pos & m_mask];
+                const std::size_t seq     = cell.m_sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if(diff == 0)
+                {
+                    // The slot is filled: claim it.
+                    if(m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        Task* t = std::launder(reinterpret_cast<Task*>(&cell.m_task));
+                        std::optional<Task> task(std::move(*t));
+                        t->~Task();
+                        cell.m_sequence.store(pos + m_capacity, std::memory_order_release);
+                        return task;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    // The slot is not yet filled: queue is empty.
+                    return {};
+                }
+                else
+                {
+                    // Another consumer claimed the slot.
+                    pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        //! Push a task, blocks while the queue is full and not closed.
+        template<typename... Args>
+        bool pushImpl(Args&&... args)
+        {
+            if(tryPushImpl(std::forward<Args>(args)...))
+            {
+                return true;
+            }
+
+            // Wake up consumers of tasks pushed so far (bulk) before sleeping.
+            notifyConsumers(true);
+
+            bool pushed = false;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            waitBegin(m_nWaitingProducers);
+            m_notFull.wait(lock, [&]() { return (pushed = tryPushImpl(std::forward<Args>(args)...)) || m_closed.load(); });
+            --m_nWaitingProducers;
+            return pushed;
+        }
+
+        //! Register a waiting consumer or producer before re-checking the queue.
+        static void waitBegin(std::atomic<std::size_t>& nWaiting)
+        {
+            nWaiting.fetch_add(1);
+            // Pairs with the fence in `notifyConsumers`/`notifyProducers`.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        //! Notify waiting consumers (if any) after a push.
+        void notifyConsumers(bool all)
+        {
+            // Pairs with the increment of `m_nWaitingConsumers` before the consumer
+            // re-checks the queue: either the consumer sees the task or we see the consumer.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(m_nWaitingConsumers.load() != 0)
+            {
+                // Lock to not miss a consumer which is just about to wait.
+                {
+                    std::scoped_lock<std::mutex> lock(m_mutex);
+                }
+                all ? m_notEmpty.notify_all() : m_notEmpty.notify_one();
+            }
+        }
+
+        //! Notify waiting producers (if any) after a pop.
+        void notifyProducers()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(m_nWaitingProducers.load() != 0)
+            {
+                {
+                    std::scoped_lock<std::mutex> lock(m_mutex);
+                }
+                m_notFull.notify_all();
+            }
+        }
+
+    private:
+        const std::size_t m_capacity;     //!< The capacity (power of two).
+        const std::size_t m_mask;         //!< Mask for the slot index `m_capacity - 1`.
+        std::unique_ptr<Cell[]> m_cells;  //!< The ring buffer.
+
+        alignas(cacheLineSize) std::atomic<std::size_t> m_tail = 0;  //!< Position of the next push.
+        alignas(cacheLineSize) std::atomic<std::size_t> m_head = 0;  //!< Position of the next pop.
+
+        alignas(cacheLineSize) std::mutex m_mutex;         //!< Mutex for sleeping producers and consumers.
+        std::condition_variable m_notEmpty;                //!< Consumers wait on this condition variable.
+        std::condition_variable m_notFull;                 //!< Producers wait on this condition variable.
+        std::atomic<std::size_t> m_nWaitingConsumers = 0;  //!< Number of waiting consumers.
+        std::atomic<std::size_t> m_nWaitingProducers = 0;  //!< Number of waiting producers.
+
+        std::atomic<bool> m_closed = false;  //!< If the queue is closed.
+    };
+}  // namespace executionGraph
@@ -0,0 +1,75 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "executionGraph/common/FileSystem.hpp"
+#include "executionGraph/common/Platform.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        CPU topology of the machine: the NUMA nodes and their CPUs.
+
+        On Linux the topology is read from `/sys/devices/system/node`.
+        Otherwise, or if this fails, the machine is described as a single node
+        with `std::thread::hardware_concurrency()` CPUs.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    class EXECGRAPH_EXPORT CpuTopology final
+    {
+    public:
+        //! A NUMA node with its CPUs.
+        struct Node
+        {
+            std::size_t m_id;                 //!< The id of the NUMA node.
+            std::vector<std::size_t> m_cpus;  //!< The ids of the CPUs of this node (sorted).
+        };
+
+    public:
+        //! Construct a topology with the nodes `nodes`.
+        //! Throws if there are no nodes or a node has no CPUs.
+        explicit CpuTopology(std::vector<Node> nodes);
+
+        //! Discover the topology of this machine from `sysNodeDir`.
+        static CpuTopology discover(const std::path& sysNodeDir = "/sys/devices/system/node");
+
+        //! Parse a CPU list like "0-3,8,10-11" (see `cpulist` in sysfs).
+        //! Throws on malformed lists.
+        static std::vector<std::size_t> parseCpuList(const std::string& cpuList);
+
+    public:
+        //! Get all NUMA nodes (sorted by id).
+        const std::vector<Node>& getNodes() const { return m_nodes; }
+        //! Get the number of NUMA nodes.
+        std::size_t getNodeCount() const { return m_nodes.size(); }
+        //! Get the number of CPUs of all nodes.
+        std::size_t getCpuCount() const;
+
+        //! Get all CPUs grouped by node, i.e. the CPUs of node 0, then node 1, etc.
+        std::vector<std::size_t> getCpusByNode() const;
+
+    private:
+        std::vector<Node> m_nodes;  //!< All NUMA nodes.
+    };
+
+    //! Pin the calling thread to the CPUs `cpus`.
+    //! Returns `false` if not supported on this platform or if it failed.
+    EXECGRAPH_EXPORT bool setCurrentThreadAffinity(const std::vector<std::size_t>& cpus);
+}  // namespace executionGraph
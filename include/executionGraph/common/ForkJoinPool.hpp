@@ -0,0 +1,227 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "executionGraph/common/AccessMacros.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        A fork-join thread pool for data-parallel work.
+
+        In contrast to `ThreadPool` (which consumes independent tasks from a queue)
+        this pool runs one job on all its threads at once and blocks the
+        calling thread until every thread has finished it (barrier semantics).
+        The calling thread takes part in the work as thread index `0`.
+
+        The first exception thrown on any thread is rethrown in the calling thread
+        after all threads have finished.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    class ForkJoinPool
+    {
+        //! No move/copy allowed!
+        EXECGRAPH_DISALLOW_COPY_AND_MOVE(ForkJoinPool)
+
+    public:
+        //! Construct a pool with `nThreads` threads in total (including the calling thread).
+        //! If `nThreads == 0` the hardware concurrency is used.
+        explicit ForkJoinPool(std::size_t nThreads = 0)
+        {
+            if(nThreads == 0)
+            {
+                nThreads = std::max(1U, std::thread::hardware_concurrency());
+            }
+
+            m_workers.reserve(nThreads - 1);
+            for(std::size_t i = 1; i < nThreads; ++i)
+            {
+                m_workers.emplace_back([this, i]() { run(i); });
+            }
+        }
+
+        //! Destructor joins all worker threads.
+        ~ForkJoinPool()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                m_finished = true;
+            }
+            m_wakeUp.notify_all();
+
+            for(auto& worker : m_workers)
+            {
+                worker.join();
+            }
+        }
+
+        //! Get the number of threads (including the calling thread).
+        std::size_t getThreadCount() const { return m_workers.size() + 1; }
+
+        //! Run `job(threadIdx)` on all threads and wait until all have returned.
+        //! The calling thread executes `job(0)`.
+        template<typename Job>
+        void runOnAll(Job&& job)
+        {
+            std::scoped_lock<std::mutex> runLock(m_runMutex);
+
+            if(m_workers.empty())
+            {
+                job(std::size_t(0));
+                return;
+            }
+
+            // Publish the job.
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                using JobType = std::remove_reference_t<Job>;
+                m_job         = const_cast<void*>(static_cast<const void*>(&job));
+                m_invokeJob   = [](void* j, std::size_t threadIdx) { (*static_cast<JobType*>(j))(threadIdx); };
+                m_pending     = m_workers.size();
+                m_exception   = nullptr;
+                ++m_generation;
+            }
+            m_wakeUp.notify_all();
+
+            // Participate.
+            invoke(0);
+
+            // Wait for all workers (barrier).
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() { return m_pending == 0; });
+            m_job = nullptr;
+
+            if(m_exception)
+            {
+                std::rethrow_exception(std::exchange(m_exception, nullptr));
+            }
+        }
+
+        //! Call `func(i)` for all `i` in `[0, n)` distributed over all threads
+        //! in chunks of `grainSize` and wait until all calls have returned.
+        //! Ranges not larger than `grainSize` are executed in the calling thread.
+        template<typename Func>
+        void parallelFor(std::size_t n, Func&& func, std::size_t grainSize = 1)
+        {
+            grainSize = std::max<std::size_t>(grainSize, 1);
+
+            if(n <= grainSize || m_workers.empty())
+            {
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    func(i);
+                }
+                return;
+            }
+
+            std::atomic<std::size_t> next = 0;
+            std::atomic<bool> cancel      = false;
+
+            runOnAll([&](std::size_t) {
+                try
+                {
+                    std::size_t start;
+                    while(!cancel.load(std::memory_order_relaxed) &&
+                          (start = next.fetch_add(grainSize, std::memory_order_relaxed)) < n)
+                    {
+                        std::size_t end = std::min(start + grainSize, n);
+                        for(std::size_t i = start; i < end; ++i)
+                        {
+                            func(i);
+                        }
+                    }
+                }
+                catch(...)
+                {
+                    cancel = true;  // Stop all other threads early.
+                    throw;
+                }
+            });
+        }
+
+    private:
+        //! Worker loop.
+        void run(std::size_t threadIdx)
+        {
+            std::size_t seenGeneration = 0;
+            while(true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wakeUp.wait(lock, [&]() { return m_finished || m_generation != seenGeneration; });
+                    if(m_finished)
+                    {
+                        return;
+                    }
+                    seenGeneration = m_generation;
+                }
+
+                invoke(threadIdx);
+
+                bool last = false;
+                {
+                    std::scoped_lock<std::mutex> lock(m_mutex);
+                    last = (--m_pending == 0);
+                }
+                if(last)
+                {
+                    m_done.notify_one();
+                }
+            }
+        }
+
+        //! Invoke the current job and store the first exception.
+        void invoke(std::size_t threadIdx)
+        {
+            try
+            {
+                m_invokeJob(m_job, threadIdx);
+            }
+            catch(...)
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                if(!m_exception)
+                {
+                    m_exception = std::current_exception();
+                }
+            }
+        }
+
+    private:
+        std::vector<std::thread> m_workers;  //!< All worker threads (the calling thread is not included).
+
+        std::mutex m_runMutex;                              //!< Serializes concurrent calls to `runOnAll`.
+        std::mutex m_mutex;                                 //!< Mutex for the job state below.
+        std::condition_variable m_wakeUp;                   //!< Workers wait on this for a new job.
+        std::condition_variable m_done;                     //!< The calling thread waits on this for the barrier.
+        void* m_job                             = nullptr;  //!< The current type-erased job.
+        void (*m_invokeJob)(void*, std::size_t) = nullptr;  //!< Invoker for `m_job`.
+        std::size_t m_generation                = 0;        //!< Incremented for each new job.
+        std::size_t m_pending                   = 0;        //!< Number of workers not yet done with the current job.
+        std::exception_ptr m_exception;                     //!< The first exception of the current job.
+        bool m_finished = false;                            //!< Flag for terminating the worker threads.
+    };
+}  // namespace executionGraph
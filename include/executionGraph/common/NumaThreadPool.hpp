@@ -0,0 +1,292 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "executionGraph/common/AccessMacros.hpp"
+#include "executionGraph/common/Assert.hpp"
+#include "executionGraph/common/CpuTopology.hpp"
+#include "executionGraph/common/TaskConsumer.hpp"
+#include "executionGraph/common/TaskQueue.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        NUMA-aware Thread-Pool.
+
+        The pool has one task queue per NUMA node of a `CpuTopology` and
+        its worker threads are pinned to the CPUs of their node.
+        Workers pop tasks from the queue of their own node first (FIFO) and
+        only take tasks from the queues of other nodes if there is no local work.
+        Tasks emplaced from inside a worker (e.g. a task spawning follow-up tasks)
+        stay on the worker's node, tasks emplaced from any other thread are
+        distributed round-robin over the nodes or placed with `emplaceOnNode`.
+
+        The tasks need the same public interface as for `TaskConsumer`:
+        - void runTask(std::thread::id)
+        - void onTaskException(std::exception_ptr e)
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename TTask>
+    class NumaThreadPool
+    {
+        //! No move/copy allowed!
+        EXECGRAPH_DISALLOW_COPY_AND_MOVE(NumaThreadPool)
+
+    public:
+        using Task = TTask;
+        static_assert(std::is_move_constructible_v<Task>);
+
+    private:
+        //! Only used for its static task dispatch `Run`.
+        using Consumer = TaskConsumer<TaskQueue<TTask>>;
+
+        //! The task queue of a NUMA node.
+        struct NodeQueue
+        {
+            NodeQueue(const CpuTopology::Node& node)
+                : m_node(node) {}
+
+            const CpuTopology::Node m_node;  //!< The NUMA node.
+            std::deque<Task> m_tasks;        //!< The tasks of this node.
+            std::mutex m_mutex;              //!< Mutex for the tasks.
+        };
+
+        //! The state of each worker thread.
+        struct Worker
+        {
+            Worker(NumaThreadPool& pool, NodeQueue& queue)
+                : m_pool(pool), m_queue(queue) {}
+
+            NumaThreadPool& m_pool;  //!< The owning pool.
+            NodeQueue& m_queue;      //!< The queue of the worker's node.
+            std::thread m_thread;    //!< The actual worker thread.
+        };
+
+    public:
+        //! Construct the pool with `threadsPerNode` workers on each node of `topology`
+        //! (`0`: one worker per CPU of the node).
+        NumaThreadPool(const CpuTopology& topology = CpuTopology::discover(),
+                       std::size_t threadsPerNode  = 0,
+                       bool pinThreads             = true)
+            : m_pinThreads(pinThreads)
+        {
+            for(auto& node : topology.getNodes())
+            {
+                m_queues.emplace_back(std::make_unique<NodeQueue>(node));
+                const std::size_t nThreads = threadsPerNode != 0 ? threadsPerNode : node.m_cpus.size();
+                for(std::size_t i = 0; i < nThreads; ++i)
+                {
+                    m_workers.emplace_back(std::make_unique<Worker>(*this, *m_queues.back()));
+                }
+            }
+            EXECGRAPH_ASSERT(!m_workers.empty(), "NumaThreadPool without workers!");
+        }
+
+        //! Destructor joins all threads.
+        virtual ~NumaThreadPool() { join(); }
+
+        //! Start all threads.
+        void start()
+        {
+            std::scoped_lock<std::mutex> lock(m_access);
+            m_finished = false;
+            for(auto& worker : m_workers)
+            {
+                if(!worker->m_thread.joinable())
+                {
+                    worker->m_thread = std::thread([this, w = worker.get()]() { run(*w); });
+                }
+            }
+        }
+
+        //! Join all threads (wait to stop them!). Not yet executed tasks stay in the pool.
+        void join()
+        {
+            std::scoped_lock<std::mutex> lock(m_access);
+            {
+                std::scoped_lock<std::mutex> sleepLock(m_sleepMutex);
+                m_finished = true;
+            }
+            m_sleepCond.notify_all();
+
+            for(auto& worker : m_workers)
+            {
+                if(worker->m_thread.joinable())
+                {
+                    worker->m_thread.join();
+                }
+            }
+        }
+
+        //! Get the number of worker threads.
+        std::size_t getThreadCount() const { return m_workers.size(); }
+        //! Get the number of NUMA nodes (queues).
+        std::size_t getNodeCount() const { return m_queues.size(); }
+        //! Get the NUMA node of queue `nodeIndex`.
+        const CpuTopology::Node& getNode(std::size_t nodeIndex) const { return m_queues[nodeIndex]->m_node; }
+
+        //! Get the node index of the calling worker thread (if it is a worker of this pool).
+        std::optional<std::size_t> getCurrentNodeIndex() const
+        {
+            Worker* worker = t_currentWorker;
+            if(worker == nullptr || &worker->m_pool != this)
+            {
+                return {};
+            }
+            return getNodeIndex(worker->m_queue);
+        }
+
+        //! Emplace a task into the pool.
+        //! If called from a worker thread of this pool, the task is placed on its own node.
+        template<typename... Args>
+        void emplace(Args&&... args)
+        {
+            Worker* worker = t_currentWorker;
+            NodeQueue* queue;
+            if(worker == nullptr || &worker->m_pool != this)
+            {
+                queue = m_queues[m_nextNode.fetch_add(1, std::memory_order_relaxed) % m_queues.size()].get();
+            }
+            else
+            {
+                queue = &worker->m_queue;
+            }
+            push(*queue, std::forward<Args>(args)...);
+        }
+
+        //! Emplace a task into the queue of node `nodeIndex` (e.g. the node owning its data).
+        template<typename... Args>
+        void emplaceOnNode(std::size_t nodeIndex, Args&&... args)
+        {
+            EXECGRAPH_ASSERT(nodeIndex < m_queues.size(), "Node index '{0}' out of range!", nodeIndex);
+            push(*m_queues[nodeIndex], std::forward<Args>(args)...);
+        }
+
+    private:
+        template<typename... Args>
+        void push(NodeQueue& queue, Args&&... args)
+        {
+            {
+                std::scoped_lock<std::mutex> lock(queue.m_mutex);
+                queue.m_tasks.emplace_back(std::forward<Args>(args)...);
+            }
+
+            m_nTasks.fetch_add(1);
+            if(m_nSleeping.load() != 0)
+            {
+                // Lock to not miss a worker which is just about to sleep.
+                // Wake all: the woken worker might be on another node.
+                std::scoped_lock<std::mutex> sleepLock(m_sleepMutex);
+                m_sleepCond.notify_all();
+            }
+        }
+
+        //! Worker run loop.
+        void run(Worker& worker)
+        {
+            t_currentWorker = &worker;
+            if(m_pinThreads)
+            {
+                setCurrentThreadAffinity(worker.m_queue.m_node.m_cpus);
+            }
+
+            const std::size_t nodeIndex = getNodeIndex(worker.m_queue);
+            while(true)
+            {
+                // Local work first, then remote work.
+                std::optional<Task> task;
+                for(std::size_t i = 0; i < m_queues.size() && !task; ++i)
+                {
+                    task = tryPop(*m_queues[(nodeIndex + i) % m_queues.size()]);
+                }
+
+                if(task)
+                {
+                    m_nTasks.fetch_sub(1);
+                    Consumer::Run(*task, std::this_thread::get_id());
+                    continue;
+                }
+
+                // No work found: sleep until some task arrives.
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_nSleeping.fetch_add(1);
+                m_sleepCond.wait(lock, [this]() { return m_finished || m_nTasks.load() != 0; });
+                m_nSleeping.fetch_sub(1);
+                if(m_finished)
+                {
+                    break;
+                }
+            }
+
+            t_currentWorker = nullptr;
+        }
+
+        //! Pop a task from the front of `queue`.
+        std::optional<Task> tryPop(NodeQueue& queue)
+        {
+            std::scoped_lock<std::mutex> lock(queue.m_mutex);
+            if(queue.m_tasks.empty())
+            {
+                return {};
+            }
+            Task task = std::move(queue.m_tasks.front());
+            queue.m_tasks.pop_front();
+            return task;
+        }
+
+        std::size_t getNodeIndex(const NodeQueue& queue) const
+        {
+            for(std::size_t i = 0; i < m_queues.size(); ++i)
+            {
+                if(m_queues[i].get() == &queue)
+                {
+                    return i;
+                }
+            }
+            EXECGRAPH_ASSERT(false, "Queue not in this pool!");
+            return 0;
+        }
+
+    private:
+        std::vector<std::unique_ptr<NodeQueue>> m_queues;  //!< The queue of each NUMA node.
+        std::vector<std::unique_ptr<Worker>> m_workers;    //!< All workers.
+        std::atomic<std::size_t> m_nextNode = 0;           //!< Round-robin counter for tasks emplaced from outside.
+        const bool m_pinThreads;                           //!< If workers are pinned to the CPUs of their node.
+
+        std::atomic<std::size_t> m_nTasks    = 0;  //!< Number of not yet popped tasks in all queues.
+        std::atomic<std::size_t> m_nSleeping = 0;  //!< Number of sleeping workers.
+        std::mutex m_sleepMutex;                   //!< Mutex for sleeping workers.
+        std::condition_variable m_sleepCond;       //!< Idle workers wait on this condition variable.
+        bool m_finished = false;                   //!< Flag for terminating the workers (guarded by `m_sleepMutex`).
+
+        std::mutex m_access;  //!< Access mutex for start/join.
+
+        static thread_local Worker* t_currentWorker;  //!< The worker of the current thread (if any).
+    };
+
+    template<typename TTask>
+    thread_local typename NumaThreadPool<TTask>::Worker* NumaThreadPool<TTask>::t_currentWorker = nullptr;
+
+}  // namespace executionGraph
@@ -47,4 +47,10 @@ namespace executionGraph
 #    endif
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+#    define EXECGRAPH_PREFETCH(address) __builtin_prefetch(address)
+#else
+#    define EXECGRAPH_PREFETCH(address)
+#endif
+
 }  // namespace executionGraph
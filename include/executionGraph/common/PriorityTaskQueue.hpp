@@ -0,0 +1,280 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "executionGraph/common/AccessMacros.hpp"
+
+namespace executionGraph
+{
+    //! Priority class of a task in a `PriorityTaskQueue`.
+    enum class TaskPriority : std::uint8_t
+    {
+        High   = 0,  //!< Interactive work (e.g. graph edits).
+        Normal = 1,  //!< Default.
+        Low    = 2   //!< Bulk work (e.g. saving, directory scans).
+    };
+
+    //! Scheduling parameters of a task in a `PriorityTaskQueue`.
+    struct TaskSchedule
+    {
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+
+        TaskSchedule(TaskPriority priority = TaskPriority::Normal,
+                     TimePoint deadline    = TimePoint::max())
+            : m_priority(priority), m_deadline(deadline) {}
+
+        //! Schedule with a deadline `timeout` from now.
+        template<typename Rep, typename Period>
+        static TaskSchedule withTimeout(TaskPriority priority, std::chrono::duration<Rep, Period> timeout)
+        {
+            return TaskSchedule(priority, Clock::now() + timeout);
+        }
+
+        TaskPriority m_priority;  //!< The priority class.
+        TimePoint m_deadline;     //!< The deadline (`TimePoint::max()` for none).
+    };
+
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        A thread-safe task queue with scheduling by priority class and deadline,
+        with the same interface as `TaskQueue`.
+
+        Tasks are popped by priority class first (`High` before `Normal` before `Low`),
+        within a class by the earliest deadline (tasks without deadline last),
+        and in FIFO order otherwise. Classes are strict: a steady stream of
+        higher priority tasks starves lower ones.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename TTask>
+    class PriorityTaskQueue
+    {
+        //! No move/copy allowed!
+        EXECGRAPH_DISALLOW_COPY_AND_MOVE(PriorityTaskQueue)
+
+    public:
+        using Task = TTask;
+        static_assert(std::is_move_constructible_v<Task>);
+
+    private:
+        //! The scheduling order of a task.
+        struct Key
+        {
+            TaskPriority m_priority;             //!< The priority class.
+            TaskSchedule::TimePoint m_deadline;  //!< The deadline.
+            std::uint64_t m_sequence;            //!< Insertion number for FIFO order.
+
+            bool operator<(const Key& other) const
+            {
+                return std::tie(m_priority, m_deadline, m_sequence) <
+                       std::tie(other.m_priority, other.m_deadline, other.m_sequence);
+            }
+        };
+
+    public:
+        PriorityTaskQueue()          = default;
+        virtual ~PriorityTaskQueue() = default;
+
+    public:
+        //! Emplace a task with the default schedule.
+        template<typename... Args>
+        void emplace(Args&&... args)
+        {
+            emplaceScheduled(TaskSchedule{}, std::forward<Args>(args)...);
+        }
+
+        //! Emplace a task with the schedule `schedule`.
+        template<typename... Args>
+        void emplaceScheduled(const TaskSchedule& schedule, Args&&... args)
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                pushLocked(schedule, std::forward<Args>(args)...);
+            }
+            m_cond.notify_one();
+        }
+
+        //! Emplace all tasks in `range` with the schedule `schedule`,
+        //! one lock and one notification (tasks are moved out of `range` if it is an rvalue).
+        template<typename TRange>
+        void emplaceBulk(TRange&& range, const TaskSchedule& schedule = {})
+        {
+            std::size_t count = 0;
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                for(auto&& task : range)
+                {
+                    if constexpr(std::is_rvalue_reference_v<TRange&&>)
+                    {
+                        pushLocked(schedule, std::move(task));
+                    }
+                    else
+                    {
+                        pushLocked(schedule, task);
+                    }
+                    ++count;
+                }
+            }
+
+            if(count == 1)
+            {
+                m_cond.notify_one();
+            }
+            else if(count > 1)
+            {
+                m_cond.notify_all();
+            }
+        }
+
+        //! Get the next scheduled task. Blocks until a task is available or the queue is closed.
+        std::optional<Task> popBlocking()
+        {
+            return popOrStop([]() { return false; });
+        }
+
+        //! Get the next scheduled task. Blocks until a task is available, the queue is closed
+        //! or `stop()` returns `true`. No task is returned once `stop()` returns `true`,
+        //! even if tasks are queued. The predicate `stop` is evaluated under the
+        //! lock of the queue, it is re-evaluated after `notifyAll()`.
+        template<typename TStop>
+        std::optional<Task> popOrStop(TStop&& stop)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [&]() { return !m_tasks.empty() || m_closed || stop(); });
+            if(stop())
+            {
+                return {};  // Stop before any further task.
+            }
+            return popLocked();
+        }
+
+        //! Get the next scheduled task. Block at most for `blockTime`.
+        std::optional<Task> pop(const std::chrono::milliseconds blockTime = std::chrono::milliseconds(200))
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait_for(lock, blockTime, [this]() { return !m_tasks.empty() || m_closed; });
+            return popLocked();
+        }
+
+        //! Append at most `maxCount` tasks in schedule order to `tasks` with one lock.
+        //! Blocks until a task is available or the queue is closed.
+        //! Returns the number of popped tasks.
+        std::size_t popBulk(std::vector<Task>& tasks, std::size_t maxCount)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]() { return !m_tasks.empty() || m_closed; });
+
+            std::size_t count = 0;
+            for(; count < maxCount; ++count)
+            {
+                auto task = popLocked();
+                if(!task)
+                {
+                    break;
+                }
+                tasks.emplace_back(std::move(*task));
+            }
+            return count;
+        }
+
+        //! Get at most `maxCount` tasks with one lock (see `popBulk(tasks, maxCount)`).
+        std::vector<Task> popBulk(std::size_t maxCount)
+        {
+            std::vector<Task> tasks;
+            popBulk(tasks, maxCount);
+            return tasks;
+        }
+
+        //! Get the number of tasks in the queue.
+        std::size_t size()
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            return m_tasks.size();
+        }
+
+        //! Close the queue and wake up all waiting consumers.
+        void close()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                m_closed = true;
+            }
+            m_cond.notify_all();
+        }
+
+        //! Open the queue again (after `close()`).
+        void open()
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            m_closed = false;
+        }
+
+        //! Check if the queue is closed.
+        bool isClosed()
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            return m_closed;
+        }
+
+        //! Wake up all waiting consumers, such that they re-evaluate their stop predicate.
+        void notifyAll()
+        {
+            // Lock to not miss a consumer which is just about to wait.
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+            }
+            m_cond.notify_all();
+        }
+
+    private:
+        //! Push a task (`m_mutex` needs to be locked).
+        template<typename... Args>
+        void pushLocked(const TaskSchedule& schedule, Args&&... args)
+        {
+            m_tasks.emplace(std::piecewise_construct,
+                            std::forward_as_tuple(Key{schedule.m_priority, schedule.m_deadline, m_sequence++}),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        //! Pop the next scheduled task if the queue is open (`m_mutex` needs to be locked).
+        std::optional<Task> popLocked()
+        {
+            if(m_closed || m_tasks.empty())
+            {
+                return {};
+            }
+            // Extract the node to move the task out (tasks need not be move-assignable).
+            auto node = m_tasks.extract(m_tasks.begin());
+            return std::optional<Task>(std::move(node.mapped()));
+        }
+
+    private:
+        std::map<Key, Task> m_tasks;     //!< All tasks in scheduling order.
+        std::uint64_t m_sequence = 0;    //!< Insertion counter.
+        std::mutex m_mutex;              //!< Mutex to lock the queue.
+        std::condition_variable m_cond;  //!< Worker wait on this condition variable.
+        bool m_closed = false;           //!< If the queue is closed (guarded by `m_mutex`).
+    };
+}  // namespace executionGraph
@@ -0,0 +1,216 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include "executionGraph/common/Assert.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Vector with inline storage for `N` elements, which only allocates
+        on the heap when more than `N` elements are stored.
+
+        Only trivially copyable types (e.g. pointers) are supported,
+        elements are never constructed or destructed individually.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename T, std::size_t N>
+    class SmallVector final
+    {
+        static_assert(N > 0, "Inline capacity needs to be positive!");
+        static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+                      "SmallVector only supports trivially copyable types!");
+
+    public:
+        using value_type     = T;
+        using size_type      = std::size_t;
+        using iterator       = T*;
+        using const_iterator = T const*;
+
+    public:
+        SmallVector() = default;
+
+        SmallVector(const SmallVector& other)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        SmallVector(SmallVector&& other) noexcept
+        {
+            moveFrom(other);
+        }
+
+        SmallVector& operator=(const SmallVector& other)
+        {
+            if(this != &other)
+            {
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) noexcept
+        {
+            if(this != &other)
+            {
+                deallocate();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        ~SmallVector() { deallocate(); }
+
+    public:
+        iterator begin() { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator begin() const { return m_data; }
+        const_iterator end() const { return m_data + m_size; }
+
+        T* data() { return m_data; }
+        T const* data() const { return m_data; }
+
+        T& operator[](size_type i)
+        {
+            EXECGRAPH_ASSERT(i < m_size, "Index out of range!");
+            return m_data[i];
+        }
+        const T& operator[](size_type i) const
+        {
+            EXECGRAPH_ASSERT(i < m_size, "Index out of range!");
+            return m_data[i];
+        }
+
+        size_type size() const { return m_size; }
+        size_type capacity() const { return m_capacity; }
+        bool empty() const { return m_size == 0; }
+        //! Check if the elements are stored in the inline storage.
+        bool isInline() const { return m_data == m_inline; }
+
+        void push_back(const T& value)
+        {
+            const T v = value;  // `value` might be an element of this vector.
+            if(m_size == m_capacity)
+            {
+                reserve(2 * m_capacity);
+            }
+            m_data[m_size++] = v;
+        }
+
+        //! Insert `value` before `pos` (order preserving).
+        iterator insert(const_iterator pos, const T& value)
+        {
+            EXECGRAPH_ASSERT(pos >= begin() && pos <= end(), "Iterator out of range!");
+            const size_type idx = pos - m_data;
+            push_back(value);
+            std::rotate(m_data + idx, m_data + m_size - 1, m_data + m_size);
+            return m_data + idx;
+        }
+
+        //! Erase the element at `pos` (order preserving).
+        iterator erase(const_iterator pos)
+        {
+            EXECGRAPH_ASSERT(pos >= begin() && pos < end(), "Iterator out of range!");
+            iterator it = m_data + (pos - m_data);
+            std::copy(it + 1, end(), it);
+            --m_size;
+            return it;
+        }
+
+        //! Erase the first element equal to `value`.
+        //! Returns `true` if an element has been erased.
+        bool eraseValue(const T& value)
+        {
+            auto it = find(value);
+            if(it == end())
+            {
+                return false;
+            }
+            erase(it);
+            return true;
+        }
+
+        const_iterator find(const T& value) const { return std::find(begin(), end(), value); }
+        iterator find(const T& value) { return std::find(begin(), end(), value); }
+        bool contains(const T& value) const { return find(value) != end(); }
+
+        void clear() { m_size = 0; }
+
+        void reserve(size_type capacity)
+        {
+            if(capacity <= m_capacity)
+            {
+                return;
+            }
+            T* data = std::allocator<T>{}.allocate(capacity);
+            std::copy(begin(), end(), data);
+            deallocate();
+            m_data     = data;
+            m_capacity = capacity;
+        }
+
+    private:
+        template<typename It>
+        void assign(It first, It last)
+        {
+            m_size = 0;
+            reserve(static_cast<size_type>(last - first));
+            m_size = static_cast<size_type>(std::copy(first, last, m_data) - m_data);
+        }
+
+        //! Take over the elements of `other` (storage must be deallocated).
+        void moveFrom(SmallVector& other) noexcept
+        {
+            if(other.isInline())
+            {
+                m_data     = m_inline;
+                m_capacity = N;
+                std::copy(other.begin(), other.end(), m_data);
+            }
+            else
+            {
+                m_data     = other.m_data;
+                m_capacity = other.m_capacity;
+            }
+            m_size = other.m_size;
+
+            other.m_data     = other.m_inline;
+            other.m_capacity = N;
+            other.m_size     = 0;
+        }
+
+        void deallocate()
+        {
+            if(!isInline())
+            {
+                std::allocator<T>{}.deallocate(m_data, m_capacity);
+                m_data     = m_inline;
+                m_capacity = N;
+            }
+        }
+
+    private:
+        T m_inline[N];                    //!< The inline storage.
+        T* m_data            = m_inline;  //!< The current storage (inline or heap).
+        size_type m_size     = 0;         //!< Number of elements.
+        size_type m_capacity = N;         //!< Capacity of the current storage.
+    };
+}  // namespace executionGraph
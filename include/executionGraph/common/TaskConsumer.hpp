@@ -15,8 +15,10 @@
 #include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
 #include <meta/meta.hpp>
 #include "executionGraph/common/AccessMacros.hpp"
+#include "executionGraph/common/CpuTopology.hpp"
 #include "executionGraph/common/SfinaeMacros.hpp"
 
 namespace executionGraph
@@ -25,6 +27,8 @@ namespace executionGraph
     /*!
         A task consumer thread which pops tasks from a thread-safe queue
         and executes them in its consumer loop.
+        The consumer blocks until a task arrives, the queue is closed or it is joined.
+        The consumer thread can be pinned to CPUs with `setAffinity`.
 
         The tasks need the following public interface: 
         - void runTask(std::thread::id)
@@ -65,6 +69,8 @@ namespace executionGraph
         void join()
         {
             m_finished = true;
+            // Wake up the consumer if it is waiting for tasks.
+            m_queue->notifyAll();
             if(m_thread.joinable())
             {
                 m_thread.join();
@@ -73,6 +79,12 @@ namespace executionGraph
 
         auto getId() { return m_thread.get_id(); }
 
+        //! Pin the consumer thread to the CPUs `cpus` (empty: no pinning).
+        //! Takes effect on the next `start()`.
+        void setAffinity(std::vector<std::size_t> cpus) { m_affinity = std::move(cpus); }
+        //! Get the CPUs the consumer thread is pinned to.
+        const std::vector<std::size_t>& getAffinity() const { return m_affinity; }
+
     private:
         template<typename T, typename = void>
         struct Dispatch;
@@ -128,20 +140,23 @@ namespace executionGraph
         //! Consumer run loop.
         void run()
         {
-            while(!m_finished)
+            if(!m_affinity.empty())
+            {
+                setCurrentThreadAffinity(m_affinity);
+            }
+
+            // An empty task means: the queue is closed or this consumer is finished.
+            while(auto optionalTask = m_queue->popOrStop([this]() { return m_finished.load(); }))
             {
-                auto optionalTask = m_queue->pop();
-                if(optionalTask)
-                {
-                    Run(*optionalTask, getId());
-                }
+                Run(*optionalTask, getId());
             }
         }
 
     private:
-        std::atomic<bool> m_finished;        //!< Flag for terminating this consumer thread
-        std::thread m_thread;                //!< The actual consumer thread.
-        std::shared_ptr<TaskQueue> m_queue;  //!< The consumer task queue.
+        std::atomic<bool> m_finished = false;  //!< Flag for terminating this consumer thread
+        std::thread m_thread;                  //!< The actual consumer thread.
+        std::shared_ptr<TaskQueue> m_queue;    //!< The consumer task queue.
+        std::vector<std::size_t> m_affinity;   //!< The CPUs the consumer thread is pinned to.
     };
 
 }  // namespace executionGraph
@@ -12,11 +12,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <type_traits>
+#include <vector>
 
 namespace executionGraph
 {
@@ -28,6 +31,10 @@ namespace executionGraph
         So the TTask type either is cheap copyable or movable.
         If your task type can not be copied or moved: use a std::shared_ptr.
 
+        Waiting consumers only wake up on new tasks or on shutdown:
+        `close()` wakes all waiting consumers and makes `pop` return no task
+        (remaining tasks stay in the queue until `open()`).
+
         @date Sun Feb 18 2018
         @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
     */
@@ -60,24 +67,153 @@ namespace executionGraph
             m_cond.notify_one();
         }
 
-        //! Get a next task. Block for `blockTime`.
+        //! Emplace all tasks in `range` with one lock and one notification
+        //! (tasks are moved out of `range` if it is an rvalue).
+        template<typename TRange>
+        void emplaceBulk(TRange&& range)
+        {
+            std::size_t count = 0;
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                for(auto&& task : range)
+                {
+                    if constexpr(std::is_rvalue_reference_v<TRange&&>)
+                    {
+                        m_queue.emplace(std::move(task));
+                    }
+                    else
+                    {
+                        m_queue.emplace(task);
+                    }
+                    ++count;
+                }
+            }
+
+            if(count == 1)
+            {
+                m_cond.notify_one();
+            }
+            else if(count > 1)
+            {
+                m_cond.notify_all();
+            }
+        }
+
+        //! Get a next task. Blocks until a task is available or the queue is closed.
+        std::optional<Task> popBlocking()
+        {
+            return popOrStop([]() { return false; });
+        }
+
+        //! Get a next task. Blocks until a task is available, the queue is closed
+        //! or `stop()` returns `true`. No task is returned once `stop()` returns `true`,
+        //! even if tasks are queued. The predicate `stop` is evaluated under the
+        //! lock of the queue, it is re-evaluated after `notifyAll()`.
+        template<typename TStop>
+        std::optional<Task> popOrStop(TStop&& stop)
+        {
+            // lock the queue (dtor unlocks)
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // releases `lock`, waits until awakend (lambda is for spurious wake up)
+            m_cond.wait(lock, [&]() { return !m_queue.empty() || m_closed || stop(); });
+            if(stop())
+            {
+                return {};  // Stop before any further task.
+            }
+            return popLocked();
+        }
+
+        //! Get a next task. Block at most for `blockTime`.
         std::optional<Task> pop(const std::chrono::milliseconds blockTime = std::chrono::milliseconds(200))
         {
             // lock the queue (dtor unlocks)
             std::unique_lock<std::mutex> lock(m_mutex);
             // releases `lock`, waits until awakend or timeOut (lambda is for spurious wake up)
-            if(m_cond.wait_for(lock, blockTime, [this]() { return !m_queue.empty(); }))
+            m_cond.wait_for(lock, blockTime, [this]() { return !m_queue.empty() || m_closed; });
+            return popLocked();
+        }
+
+        //! Append at most `maxCount` tasks to `tasks` with one lock.
+        //! Blocks until a task is available or the queue is closed.
+        //! Returns the number of popped tasks.
+        std::size_t popBulk(std::vector<Task>& tasks, std::size_t maxCount)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]() { return !m_queue.empty() || m_closed; });
+            if(m_closed)
             {
-                Task task = std::move(m_queue.front());  // `lock` is locked
+                return 0;
+            }
+
+            std::size_t count = std::min(maxCount, m_queue.size());
+            tasks.reserve(tasks.size() + count);
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                tasks.emplace_back(std::move(m_queue.front()));
                 m_queue.pop();
-                return task;
             }
-            return {};
+            return count;
+        }
+
+        //! Get at most `maxCount` tasks with one lock (see `popBulk(tasks, maxCount)`).
+        std::vector<Task> popBulk(std::size_t maxCount)
+        {
+            std::vector<Task> tasks;
+            popBulk(tasks, maxCount);
+            return tasks;
+        }
+
+        //! Close the queue and wake up all waiting consumers.
+        void close()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+                m_closed = true;
+            }
+            m_cond.notify_all();
+        }
+
+        //! Open the queue again (after `close()`).
+        void open()
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            m_closed = false;
+        }
+
+        //! Check if the queue is closed.
+        bool isClosed()
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            return m_closed;
+        }
+
+        //! Wake up all waiting consumers, such that they re-evaluate their stop predicate.
+        void notifyAll()
+        {
+            // Lock to not miss a consumer which is just about to wait.
+            {
+                std::scoped_lock<std::mutex> lock(m_mutex);
+            }
+            m_cond.notify_all();
+        }
+
+    private:
+        //! Pop the front task if the queue is open (`m_mutex` needs to be locked).
+        std::optional<Task> popLocked()
+        {
+            if(m_closed || m_queue.empty())
+            {
+                return {};
+            }
+            Task task = std::move(m_queue.front());
+            m_queue.pop();
+            return task;
         }
 
     private:
         std::queue<Task> m_queue;        //!< The queue with all work items.
         std::mutex m_mutex;              //!< Mutex to lock the queue.
         std::condition_variable m_cond;  //!< Worker wait on this condition variable.
+        bool m_closed = false;           //!< If the queue is closed (guarded by `m_mutex`).
     };
 }  // namespace executionGraph
@@ -13,6 +13,9 @@
 #pragma once
 
 #include <mutex>
+#include "executionGraph/common/BoundedTaskQueue.hpp"
+#include "executionGraph/common/CpuTopology.hpp"
+#include "executionGraph/common/PriorityTaskQueue.hpp"
 #include "executionGraph/common/TaskConsumer.hpp"
 #include "executionGraph/common/TaskQueue.hpp"
 
@@ -22,11 +25,15 @@ namespace executionGraph
     /*!
         Simple Thread-Pool.
 
+        The task queue `TQueue` is either the unbounded `TaskQueue`,
+        the bounded lock-free `BoundedTaskQueue`, the `PriorityTaskQueue`
+        for scheduling by priority and deadline (or any queue with the same interface).
+
         @date Thu Feb 22 2018
         @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
     */
     /* ---------------------------------------------------------------------------------------*/
-    template<typename TTask>
+    template<typename TTask, typename TQueue = TaskQueue<TTask>>
     class ThreadPool
     {
         //! No move/copy allowed!
@@ -34,12 +41,15 @@ namespace executionGraph
 
     public:
         using Task     = TTask;
-        using Queue    = TaskQueue<TTask>;
+        using Queue    = TQueue;
         using Consumer = TaskConsumer<Queue>;
 
     public:
-        ThreadPool(std::size_t nThreads)
-            : m_queue(std::make_shared<Queue>())
+        //! Construct the pool with `nThreads` and the queue constructed with `queueArgs`
+        //! (e.g. the capacity of a `BoundedTaskQueue`).
+        template<typename... QueueArgs>
+        ThreadPool(std::size_t nThreads, QueueArgs&&... queueArgs)
+            : m_queue(std::make_shared<Queue>(std::forward<QueueArgs>(queueArgs)...))
         {
             for(auto i = 0; i < nThreads; ++i)
             {
@@ -47,29 +57,57 @@ namespace executionGraph
             }
         };
 
-        //! Destructor joins all threads automatically by the DTOR of Consumer.
-        virtual ~ThreadPool() = default;
+        //! Destructor joins all threads.
+        virtual ~ThreadPool() { join(); }
 
         //! Start all threads.
         void start()
         {
             std::scoped_lock<std::mutex> lock(m_access);
+            m_queue->open();
             for(auto& consumer : m_consumers)
             {
                 consumer->start();
             }
         }
 
-        //! Join all threads.
+        //! Join all threads. Not yet executed tasks stay in the queue.
         void join()
         {
             std::scoped_lock<std::mutex> lock(m_access);
+            // Wake up all consumers at once.
+            m_queue->close();
             for(auto& consumer : m_consumers)
             {
                 consumer->join();
             }
         }
 
+        //! Pin each thread to one CPU of `topology`, filling one NUMA node after the other.
+        //! Takes effect on the next `start()`.
+        void pinThreadsToCpus(const CpuTopology& topology)
+        {
+            std::scoped_lock<std::mutex> lock(m_access);
+            const auto cpus = topology.getCpusByNode();
+            for(std::size_t i = 0; i < m_consumers.size(); ++i)
+            {
+                m_consumers[i]->setAffinity({cpus[i % cpus.size()]});
+            }
+        }
+
+        //! Pin the threads to the CPUs of the NUMA nodes of `topology`,
+        //! consecutive threads are grouped on the same node.
+        //! Takes effect on the next `start()`.
+        void pinThreadsToNodes(const CpuTopology& topology)
+        {
+            std::scoped_lock<std::mutex> lock(m_access);
+            const auto& nodes = topology.getNodes();
+            for(std::size_t i = 0; i < m_consumers.size(); ++i)
+            {
+                m_consumers[i]->setAffinity(nodes[i * nodes.size() / m_consumers.size()].m_cpus);
+            }
+        }
+
         //! Return the thread-safe queue into which task can be placed.
         const std::shared_ptr<Queue>& getQueue() { return m_queue; }
 
@@ -0,0 +1,249 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+#include "executionGraph/common/AccessMacros.hpp"
+#include "executionGraph/common/TaskConsumer.hpp"
+#include "executionGraph/common/TaskQueue.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Work-Stealing Thread-Pool.
+
+        Each worker thread owns a deque of tasks. Tasks emplaced from inside a
+        worker (e.g. a task spawning follow-up tasks) are pushed to the back of
+        the worker's own deque and popped again from the back (LIFO, cache-friendly).
+        Tasks emplaced from any other thread are distributed round-robin over
+        the workers. An idle worker steals from the front of a randomly chosen
+        other worker's deque and sleeps only if there is no work at all.
+
+        The tasks need the same public interface as for `TaskConsumer`:
+        - void runTask(std::thread::id)
+        - void onTaskException(std::exception_ptr e)
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename TTask>
+    class WorkStealingThreadPool
+    {
+        //! No move/copy allowed!
+        EXECGRAPH_DISALLOW_COPY_AND_MOVE(WorkStealingThreadPool)
+
+    public:
+        using Task = TTask;
+        static_assert(std::is_move_constructible_v<Task>);
+
+    private:
+        //! Only used for its static task dispatch `Run`.
+        using Consumer = TaskConsumer<TaskQueue<TTask>>;
+
+        //! The state of each worker thread.
+        struct Worker
+        {
+            Worker(WorkStealingThreadPool& pool, std::size_t index)
+                : m_pool(pool), m_index(index), m_random(static_cast<unsigned int>(index + 1)) {}
+
+            WorkStealingThreadPool& m_pool;  //!< The owning pool.
+            const std::size_t m_index;       //!< The index of this worker in the pool.
+            std::minstd_rand m_random;       //!< Random generator for choosing a victim to steal from.
+
+            std::deque<Task> m_tasks;  //!< The tasks of this worker.
+            std::mutex m_mutex;        //!< Mutex for the tasks (only contended while stealing).
+
+            std::thread m_thread;  //!< The actual worker thread.
+        };
+
+    public:
+        WorkStealingThreadPool(std::size_t nThreads)
+        {
+            nThreads = std::max<std::size_t>(nThreads, 1);
+            for(std::size_t i = 0; i < nThreads; ++i)
+            {
+                m_workers.emplace_back(std::make_unique<Worker>(*this, i));
+            }
+        }
+
+        //! Destructor joins all threads.
+        virtual ~WorkStealingThreadPool() { join(); }
+
+        //! Start all threads.
+        void start()
+        {
+            std::scoped_lock<std::mutex> lock(m_access);
+            m_finished = false;
+            for(auto& worker : m_workers)
+            {
+                if(!worker->m_thread.joinable())
+                {
+                    worker->m_thread = std::thread([this, w = worker.get()]() { run(*w); });
+                }
+            }
+        }
+
+        //! Join all threads (wait to stop them!). Not yet executed tasks stay in the pool.
+        void join()
+        {
+            std::scoped_lock<std::mutex> lock(m_access);
+            {
+                std::scoped_lock<std::mutex> sleepLock(m_sleepMutex);
+                m_finished = true;
+            }
+            m_sleepCond.notify_all();
+
+            for(auto& worker : m_workers)
+            {
+                if(worker->m_thread.joinable())
+                {
+                    worker->m_thread.join();
+                }
+            }
+        }
+
+        //! Get the number of worker threads.
+        std::size_t getThreadCount() const { return m_workers.size(); }
+
+        //! Emplace a task into the pool.
+        //! If called from a worker thread of this pool, the task is pushed to its own deque.
+        template<typename... Args>
+        void emplace(Args&&... args)
+        {
+            Worker* worker = t_currentWorker;
+            if(worker == nullptr || &worker->m_pool != this)
+            {
+                worker = m_workers[m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size()].get();
+            }
+
+            {
+                std::scoped_lock<std::mutex> lock(worker->m_mutex);
+                worker->m_tasks.emplace_back(std::forward<Args>(args)...);
+            }
+
+            m_nTasks.fetch_add(1);
+            if(m_nSleeping.load() != 0)
+            {
+                // Lock to not miss a worker which is just about to sleep.
+                std::scoped_lock<std::mutex> sleepLock(m_sleepMutex);
+                m_sleepCond.notify_one();
+            }
+        }
+
+    private:
+        //! Worker run loop.
+        void run(Worker& worker)
+        {
+            t_currentWorker = &worker;
+
+            while(true)
+            {
+                std::optional<Task> task = popLocal(worker);
+                if(!task)
+                {
+                    task = steal(worker);
+                }
+
+                if(task)
+                {
+                    m_nTasks.fetch_sub(1);
+                    Consumer::Run(*task, std::this_thread::get_id());
+                    continue;
+                }
+
+                // No work found: sleep until some task arrives.
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_nSleeping.fetch_add(1);
+                m_sleepCond.wait(lock, [this]() { return m_finished || m_nTasks.load() != 0; });
+                m_nSleeping.fetch_sub(1);
+                if(m_finished)
+                {
+                    break;
+                }
+            }
+
+            t_currentWorker = nullptr;
+        }
+
+        //! Pop a task from the back of the own deque.
+        std::optional<Task> popLocal(Worker& worker)
+        {
+            std::scoped_lock<std::mutex> lock(worker.m_mutex);
+            if(worker.m_tasks.empty())
+            {
+                return {};
+            }
+            Task task = std::move(worker.m_tasks.back());
+            worker.m_tasks.pop_back();
+            return task;
+        }
+
+        //! Steal a task from the front of another randomly chosen worker's deque.
+        std::optional<Task> steal(Worker& thief)
+        {
+            const std::size_t nWorkers = m_workers.size();
+            if(nWorkers < 2)
+            {
+                return {};
+            }
+
+            std::size_t start = thief.m_random() % nWorkers;
+            for(std::size_t i = 0; i < nWorkers; ++i)
+            {
+                Worker& victim = *m_workers[(start + i) % nWorkers];
+                if(&victim == &thief)
+                {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(victim.m_mutex, std::try_to_lock);
+                if(!lock.owns_lock() || victim.m_tasks.empty())
+                {
+                    continue;
+                }
+                Task task = std::move(victim.m_tasks.front());
+                victim.m_tasks.pop_front();
+                return task;
+            }
+            return {};
+        }
+
+    private:
+        std::vector<std::unique_ptr<Worker>> m_workers;  //!< All workers.
+        std::atomic<std::size_t> m_nextWorker = 0;       //!< Round-robin counter for tasks emplaced from outside.
+
+        std::atomic<std::size_t> m_nTasks    = 0;  //!< Number of not yet popped tasks in all deques.
+        std::atomic<std::size_t> m_nSleeping = 0;  //!< Number of sleeping workers.
+        std::mutex m_sleepMutex;                   //!< Mutex for sleeping workers.
+        std::condition_variable m_sleepCond;       //!< Idle workers wait on this condition variable.
+        bool m_finished = false;                   //!< Flag for terminating the workers (guarded by `m_sleepMutex`).
+
+        std::mutex m_access;  //!< Access mutex for start/join.
+
+        static thread_local Worker* t_currentWorker;  //!< The worker of the current thread (if any).
+    };
+
+    template<typename TTask>
+    thread_local typename WorkStealingThreadPool<TTask>::Worker* WorkStealingThreadPool<TTask>::t_currentWorker = nullptr;
+
+}  // namespace executionGraph
@@ -10,6 +10,9 @@
 //  file, You can obtain one at http://mozilla.org/MPL/2.0/.
 // =========================================================================================
 
+#pragma once
+
+#include <vector>
 #include "executionGraph/nodes/LogicCommon.hpp"
 #include "executionGraph/nodes/SocketLinkDescription.hpp"
 
@@ -13,18 +13,34 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <deque>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
 #include <set>
 #include <unordered_set>
 #include <fmt/printf.h>
 #include <rttr/type>
 #include "executionGraph/common/Assert.hpp"
 #include "executionGraph/common/DemangleTypes.hpp"
+#include "executionGraph/common/ForkJoinPool.hpp"
+#include "executionGraph/common/Platform.hpp"
+#include "executionGraph/common/SmallVector.hpp"
 #include "executionGraph/common/StringFormat.hpp"
+#include "executionGraph/graphs/CycleDescription.hpp"
+#include "executionGraph/graphs/NodeSlotMap.hpp"
+#include "executionGraph/graphs/ReachabilityIndex.hpp"
+#include "executionGraph/graphs/StronglyConnectedComponents.hpp"
 #include "executionGraph/nodes/LogicCommon.hpp"
 #include "executionGraph/nodes/LogicNode.hpp"
 #include "executionGraph/nodes/LogicNodeDefaultPool.hpp"
 #include "executionGraph/nodes/LogicSocket.hpp"
+#include "executionGraph/serialization/SocketValueSnapshot.hpp"
 
 #define EXECGRAPH_EXECTREE_SOLVER_LOG(...) EXECGRAPH_DEBUG_ONLY(EXECGRAPH_LOG_TRACE(__VA_ARGS__));
 
@@ -35,6 +51,8 @@ namespace executionGraph
         Execution Graph which stores all nodes and lets them execute in order such that 
         all dependencies (inputs) of any node is computed before it is computed.
 
+        All nodes are stored in slot maps (`NodeSlotMap`) which resolve node ids in O(1).
+
         @todo When saving an execution graph, we should make a remapping to linear ids. 
 
         @date Tue Sep 11 2018
@@ -58,6 +76,23 @@ namespace executionGraph
 
         using GroupId = unsigned int;
 
+        //! The mode how `runExecute` and `runReset` traverse the execution order.
+        enum class ExecutionMode : unsigned char
+        {
+            Serial,          //!< All nodes are executed one after another on the calling thread.
+            ParallelLevels,  //!< All nodes with the same priority are executed in parallel, with a barrier between priorities.
+            DataFlow         //!< Each node is executed in parallel as soon as all its parent nodes (Get-Links and Write-Links) have finished.
+        };
+
+        //! The memory layout of the output socket values of nodes created with `createNode`.
+        enum class ValueLayout : unsigned char
+        {
+            PerSocket,  //!< Each value is stored inline in its output socket.
+            Arena       //!< All values are stored contiguously by type in the tree's `SocketValueArena`.
+        };
+
+        using SocketValueArena = typename NodeBaseType::SocketValueArena;
+
     private:
         static const std::underlying_type_t<NodeClassification> m_nNodeClasses = 4;
 
@@ -82,37 +117,121 @@ namespace executionGraph
                 : NodeDataBase(std::forward<Args>(args)...)
             {}
 
-            std::unordered_set<GroupId> m_groups;  //!< To which group ids this node belongs.
-            IndexType m_priority = 0;              //!< The priority of this node
+            SmallVector<GroupId, 2> m_groups;                                    //!< To which group ids this node belongs (sorted).
+            IndexType m_priority       = 0;                                      //!< The priority of this node
+            IndexType m_planIndex      = std::numeric_limits<IndexType>::max();  //!< The index of this node in the global execution plan (if compiled).
+            IndexType m_traversalIndex = 0;                                      //!< Scratch index of this node for graph traversals (e.g. the solvers, cycle detection).
 
-            void resetTraversalParameters() { m_flags = 0; }
-            enum TraversalFlags : int
+            //! Check if this node belongs to the group with id `groupId`.
+            bool isInGroup(GroupId groupId) const
             {
-                Visited,          //!< All visited nodes (globally)
-                OnCurrentDFRPath  //!< This mark is set for all nodes on the current depth-first recursion path.
-            };
-            bool isFlagSet(TraversalFlags position) const { return m_flags & (1 << position); }
-            void setFlag(TraversalFlags position) { m_flags |= (1 << position); }
-            void unsetFlag(TraversalFlags position) { m_flags &= ~(1 << position); }
-
-        private:
-            int m_flags = 0;  //! Some flags for graph traversal
+                return std::binary_search(m_groups.begin(), m_groups.end(), groupId);
+            }
         };
 
-        using ConstantNodeDataStorage = std::unordered_map<NodeId, NodeDataBase>;
-        using NodeDataStorage         = std::unordered_map<NodeId, NodeData>;  // Rehashing does not invalidate pointers or references to elements.
+        using ConstantNodeDataStorage = NodeSlotMap<NodeDataBase>;
+        using NodeDataStorage         = NodeSlotMap<NodeData>;  // Growing does not invalidate pointers or references to elements.
 
         using NodeDataList = std::vector<NodeData*>;
         using NodeDataSet  = std::unordered_set<NodeData*>;
-        using NodeDataMap  = std::unordered_map<NodeId, NodeDataBase*>;
+        using NodeDataMap  = NodeSlotMap<NodeDataBase*>;
+        using NodeHandle   = typename NodeDataMap::Handle;  //!< Handle to a node, which detects removed nodes.
 
-        using GroupNodeMap = std::unordered_map<GroupId, NodeDataSet>;
-
-        using PrioritySet        = std::map<IndexType, NodeDataList, std::greater<IndexType>>;
-        using GroupExecutionList = std::unordered_map<GroupId, PrioritySet>;
+        using PrioritySet = std::map<IndexType, NodeDataList, std::greater<IndexType>>;
 
         using LogicNodeDefaultOutputs = LogicNodeDefaultPool<TConfig>;
 
+        //! One entry of a compiled execution plan.
+        struct ExecutionRecord
+        {
+            NodeBaseType* m_node     = nullptr;  //!< The node to execute.
+            IndexType m_globalIndex  = 0;        //!< The index of this record in the global execution plan.
+            IndexType m_priority     = 0;        //!< The priority of the node.
+            IndexType m_inputsBegin  = 0;        //!< Begin of this node's entries in `ExecutionPlan::m_inputData`.
+            IndexType m_inputsEnd    = 0;        //!< End of this node's entries in `ExecutionPlan::m_inputData`.
+            IndexType m_outputsBegin = 0;        //!< Begin of this node's entries in `ExecutionPlan::m_outputData`.
+            IndexType m_outputsEnd   = 0;        //!< End of this node's entries in `ExecutionPlan::m_outputData`.
+        };
+
+        //! A compiled execution order: all nodes in one contiguous array in execution order.
+        struct ExecutionPlan
+        {
+            std::vector<ExecutionRecord> m_records;       //!< All nodes in execution order.
+            std::vector<IndexType> m_levelOffsets;        //!< Offsets into `m_records` of each priority level (size `nLevels + 1`).
+            std::vector<void const* const*> m_inputData;  //!< Addresses of the data pointers of all input sockets.
+            std::vector<void const*> m_outputData;        //!< Data pointers of all output sockets.
+
+            // Dependency counting (only for `ExecutionMode::DataFlow`).
+            std::vector<IndexType> m_inDegree;          //!< Number of distinct parent nodes (Get-Links and Write-Links) of each record.
+            std::vector<IndexType> m_successorOffsets;  //!< Offsets into `m_successors` for each record (size `m_records.size() + 1`).
+            std::vector<IndexType> m_successors;        //!< Indices of the successor records of all records (compressed).
+            std::vector<IndexType> m_roots;             //!< Indices of all records without parents.
+
+            std::unique_ptr<std::atomic<IndexType>[]> m_pending;  //!< Number of not yet finished parents of each record (run state).
+            std::vector<IndexType> m_ready;                       //!< Indices of all records ready for execution (run state).
+        };
+
+        //! The execution order of a group: a view into the global execution plan.
+        struct GroupSpan
+        {
+            IndexType m_nodeCount = 0;              //!< Number of nodes in this group.
+            std::vector<IndexType> m_records;       //!< Indices of the group's records in the global execution plan (in execution order).
+            std::vector<IndexType> m_levelOffsets;  //!< Offsets into `m_records` of each priority level (size `nLevels + 1`).
+        };
+        using GroupSpans = std::unordered_map<GroupId, GroupSpan>;
+
+        //! A compiled Write-Link: the data pointer `m_src` of an output socket
+        //! which is written to the data pointer slot `m_slot` of an input socket.
+        struct WriteLinkSlot
+        {
+            void const** m_slot = nullptr;  //!< The data pointer slot of the input socket.
+            void const* m_src   = nullptr;  //!< The data pointer of the output socket.
+        };
+
+        //! Type-erased operations on the value of an output socket (for pipeline buffers).
+        struct PipelineBufferOps
+        {
+            std::shared_ptr<void> (*m_create)(void const* value);  //!< Create a copy of `value`.
+            void (*m_assign)(void* dest, void const* value);       //!< Assign `value` to `dest`.
+        };
+
+        //! The buffers of an output socket whose value is consumed in later pipeline stages.
+        struct PipelineBuffer
+        {
+            SocketOutputBaseType* m_output = nullptr;    //!< The buffered output socket.
+            const PipelineBufferOps* m_ops = nullptr;    //!< Operations for the value type of `m_output`.
+            std::vector<std::shared_ptr<void>> m_slots;  //!< One buffered value for each frame slot.
+        };
+
+        //! An input socket which reads a buffered value from an earlier pipeline stage.
+        struct PipelineInput
+        {
+            SocketInputBaseType* m_input = nullptr;  //!< The input socket.
+            IndexType m_buffer           = 0;        //!< Index of the buffer in `Pipeline::m_buffers`.
+        };
+
+        //! A pipeline stage: a range of consecutive priority levels of the global execution plan.
+        struct PipelineStage
+        {
+            IndexType m_recordsBegin = 0;         //!< Begin of this stage's records in the global execution plan.
+            IndexType m_recordsEnd   = 0;         //!< End of this stage's records in the global execution plan.
+            IndexType m_lastConsumer = 0;         //!< The last stage consuming buffered values of this stage.
+            std::vector<IndexType> m_outputs;     //!< Buffers which this stage publishes after each frame.
+            std::vector<PipelineInput> m_inputs;  //!< Input sockets which this stage redirects before each frame.
+        };
+
+        //! The compiled pipeline for `runPipelined`.
+        struct Pipeline
+        {
+            std::size_t m_nStages  = 1;      //!< The requested number of stages.
+            std::size_t m_nBuffers = 2;      //!< The number of buffered values for each output consumed in a later stage.
+            bool m_upToDate        = false;  //!< If the pipeline is compiled for the current execution order.
+
+            std::vector<PipelineStage> m_stages;    //!< All stages in execution order.
+            std::vector<PipelineBuffer> m_buffers;  //!< All buffers.
+            std::unique_ptr<ForkJoinPool> m_pool;   //!< One thread for each stage.
+        };
+
         struct GraphTypeDescription
         {
             std::unordered_set<std::string> m_nodeTypes;    //!< Type names of the available and creatable nodes on this graph.
@@ -125,9 +244,27 @@ namespace executionGraph
             addDefaultOutputPool();
         }
 
-        ~ExecutionTree() = default;
+        //! Construct a tree whose nodes created with `createNode` (and their sockets)
+        //! are allocated from the memory resource `nodeMemory`, e.g. an arena like
+        //! `std::pmr::monotonic_buffer_resource` or a pool like `std::pmr::unsynchronized_pool_resource`
+        //! (`nullptr` uses `new`/`delete`). With `ValueLayout::Arena` the output socket values of these
+        //! nodes are stored contiguously by type (see `getValueArena`).
+        //! The memory is released in bulk when the tree is destroyed, therefore
+        //! no node of this tree may outlive it (`removeNode` destroys these nodes).
+        explicit ExecutionTree(std::unique_ptr<std::pmr::memory_resource> nodeMemory,
+                               ValueLayout valueLayout = ValueLayout::PerSocket)
+            : m_nodeMemory(std::move(nodeMemory))
+            , m_valueArena(valueLayout == ValueLayout::Arena ? std::make_unique<SocketValueArena>() : nullptr)
+        {
+            addDefaultOutputPool();
+        }
+
+        //! Destructor: all nodes are destroyed before the node memory they live in.
+        ~ExecutionTree() { clearNodes(); }
 
         ExecutionTree(ExecutionTree&&) = default;
+        //! Member-wise move assignment: the node memory and the value arena are declared last,
+        //! such that all nodes are destroyed before the memory they live in.
         ExecutionTree& operator=(ExecutionTree&&) = default;
 
         //! Set the node class of a specific node id `nodeId`.
@@ -135,6 +272,7 @@ namespace executionGraph
         void setNodeClass(NodeId nodeId, NodeClassification newType)
         {
             m_executionOrderUpToDate = false;
+            m_checkReachability      = true;
 
             auto it = m_nonConstNodes.find(nodeId);
             EXECGRAPH_THROW_IF(it == m_nonConstNodes.end(),
@@ -161,6 +299,32 @@ namespace executionGraph
             setNodeClass(node.getId(), newType);
         }
 
+        //! Construct a node of type `TNode` with the arguments `args` in the node memory of this tree.
+        //! The node still needs to be added with `addNode`.
+        template<typename TNode, typename... Args>
+        std::unique_ptr<TNode> createNode(Args&&... args)
+        {
+            typename NodeBaseType::MemoryResourceScope scope(getNodeMemoryResource(), m_valueArena.get());
+            return std::make_unique<TNode>(std::forward<Args>(args)...);
+        }
+
+        //! Get the memory resource for nodes of this tree.
+        //! Use it in a `NodeBaseType::MemoryResourceScope` to construct nodes in any other way.
+        std::pmr::memory_resource* getNodeMemoryResource() const
+        {
+            return m_nodeMemory ? m_nodeMemory.get() : std::pmr::new_delete_resource();
+        }
+
+        //! Get the arena with the output socket values of all nodes created with `createNode`
+        //! (`nullptr` if the value layout is not `ValueLayout::Arena`).
+        //! The values of one type can be read in memory order, e.g. `getValueArena()->getPool<double>().forEach(...)`.
+        SocketValueArena* getValueArena() { return m_valueArena.get(); }
+        //! Const overload.
+        const SocketValueArena* getValueArena() const { return m_valueArena.get(); }
+
+        //! Get the value layout of nodes created with `createNode`.
+        ValueLayout getValueLayout() const { return m_valueArena ? ValueLayout::Arena : ValueLayout::PerSocket; }
+
         //! Generate a new unique node id (not yet contained in the graph).
         NodeId generateNodeId()
         {
@@ -170,7 +334,7 @@ namespace executionGraph
         }
         //! Get a specific node with id `nodeId` if it exists, nullptr otherwise.
         //! This invalidates the execution order, since we cannot guarantee that the caller added other links.
-        //! To circumvent that, use the const method.
+        //! The next `setup()` needs a full solve. To circumvent that, use the const method.
         NodeBaseType* getNode(NodeId nodeId)
         {
             auto it = m_nodes.find(nodeId);
@@ -179,15 +343,26 @@ namespace executionGraph
                 return nullptr;
             }
             m_executionOrderUpToDate = false;
+            m_needsFullSolve         = true;
             return it->second->m_node.get();
         }
         //! Get a specific node with id `nodeId` if it exists, nullptr otherwise.
         //! Does not invalidate execution order.
         const NodeBaseType* getNode(NodeId nodeId) const
         {
-            auto* p                  = static_cast<ExecutionTree<Config> const*>(this)->getNode(nodeId);
-            m_executionOrderUpToDate = true;
-            return p;
+            auto it = m_nodes.find(nodeId);
+            return it == m_nodes.end() ? nullptr : it->second->m_node.get();
+        }
+
+        //! Get the handle to the node with id `nodeId` (invalid if not existing).
+        //! A handle resolves in O(1) and detects if the node has been removed in the meantime.
+        NodeHandle getNodeHandle(NodeId nodeId) const { return m_nodes.getHandle(nodeId); }
+        //! Get the node of handle `handle` if it still exists, nullptr otherwise.
+        //! Does not invalidate execution order.
+        const NodeBaseType* getNode(const NodeHandle& handle) const
+        {
+            auto* nodeData = m_nodes.get(handle);
+            return nodeData ? (*nodeData)->m_node.get() : nullptr;
         }
 
         //! Get the pool of default output sockets.
@@ -195,16 +370,23 @@ namespace executionGraph
         LogicNodeDefaultOutputs& getDefaultOuputPool() { return *m_nodeDefaultOutputPool; }
 
         //! Get all nodes classified as `type`.
-        const NodeDataSet& getNodes(NodeClassification type) const { return m_nodeClassifications[type]; }
+        const std::set<NodeBaseType*>& getNodes(NodeClassification type) const { return m_nodeClassifications[type]; }
 
-        //! Get all nodes in the group with id `groupId`.
-        const NodeDataSet& getNodes(GroupId groupId) const
+        //! Get all nodes in the group with id `groupId` (filtered scan over all nodes).
+        std::vector<const NodeData*> getNodes(GroupId groupId) const
         {
-            auto it = m_nodeGroups.find(groupId);
-            EXECGRAPH_THROW_IF(it == m_nodeGroups.end(),
+            EXECGRAPH_THROW_IF(m_groupSpans.find(groupId) == m_groupSpans.end(),
                                "Group with id: '{0}' is not part of the tree!",
                                groupId);
-            return it->second;
+            std::vector<const NodeData*> nodes;
+            for(auto& keyValue : m_nonConstNodes)
+            {
+                if(keyValue.second.isInGroup(groupId))
+                {
+                    nodes.emplace_back(&keyValue.second);
+                }
+            }
+            return nodes;
         }
 
         //! Get all nodes in this graph: all but constant nodes, and only constant nodes.
@@ -237,16 +419,19 @@ namespace executionGraph
             if(type == NodeClassification::ConstantNode)
             {
                 // Constant node
-                auto p      = m_constNodes.emplace(id, NodeDataBase{std::move(node), type});
-                m_nodes[id] = &p.first->second;
+                auto p = m_constNodes.emplace(id, std::move(node), type);
+                m_nodes.emplace(id, &p.first->second);
             }
             else
             {
                 // Any other node
-                auto p      = m_nonConstNodes.emplace(id, NodeData{std::move(node), type});
-                m_nodes[id] = &p.first->second;
+                auto p = m_nonConstNodes.emplace(id, std::move(node), type);
+                m_nodes.emplace(id, &p.first->second);
                 // Add node to group
                 addNodeToGroup(id, groupId);
+
+                // Adjust priorities for all links the node already has.
+                onNodeAdded(p.first->second);
             }
 
             // Add to classes
@@ -258,6 +443,9 @@ namespace executionGraph
         }
 
         //! Remove an node with id `nodeId` from the graph.
+        //! The ownership of the node is returned, except if the node lives in the node memory or
+        //! the value arena owned by this tree (see `createNode`): such a node cannot outlive the tree,
+        //! it is destroyed and `nullptr` is returned.
         //! Any error is fatal ==> UB.
         NodePointer removeNode(NodeId nodeId)
         {
@@ -274,6 +462,19 @@ namespace executionGraph
                              "Error while erasing node id '{0}'",
                              nodeId);
 
+            // All children might have dangling inputs after removal.
+            forEachChild(*nodeDataBase->m_node, [&](NodeData& child) {
+                m_danglingCheckNodes.emplace(child.m_node->getId());
+                markStale(child);
+            });
+            m_checkReachability = true;
+
+            // All parents might get lower priorities after removal.
+            m_lowerNodes.clear();
+            forEachParent(*nodeDataBase->m_node, [&](NodeData& parent) {
+                m_lowerNodes.emplace_back(parent.m_node->getId());
+            });
+
             // Move the node out!
             NodePointer node = std::move(nodeDataBase->m_node);
 
@@ -290,14 +491,14 @@ namespace executionGraph
                 // Remove from groups.
                 for(auto groupId : nodeData->m_groups)
                 {
-                    auto groupIt = m_nodeGroups.find(groupId);
-                    EXECGRAPH_ASSERT(groupIt != m_nodeGroups.end(),
+                    auto groupIt = m_groupSpans.find(groupId);
+                    EXECGRAPH_ASSERT(groupIt != m_groupSpans.end() && groupIt->second.m_nodeCount > 0,
                                      "No such group id '{0}' found!",
                                      groupId);
-                    EXECGRAPH_VERIFY(groupIt->second.erase(nodeData),
-                                     "Removing node id '{0}' from groud id '{0}' failed!",
-                                     nodeId,
-                                     groupId);
+                    if(--groupIt->second.m_nodeCount == 0)
+                    {
+                        m_groupSpans.erase(groupIt);
+                    }
                 }
 
                 // Remove from non-constant nodes.
@@ -314,9 +515,21 @@ namespace executionGraph
                 --m_nextNodeId;
             }
 
+            for(auto parentId : m_lowerNodes)
+            {
+                onLinkRemoved(parentId);
+            }
+
             // Execution order is not up-to-date.
             m_executionOrderUpToDate = false;
 
+            // Never hand out nodes whose memory is released with this tree.
+            if((m_nodeMemory && node->getMemoryResource() == m_nodeMemory.get()) ||
+               (m_valueArena && node->getValueArena() == m_valueArena.get()))
+            {
+                return nullptr;
+            }
+
             return std::move(node);
         }
 
@@ -327,9 +540,15 @@ namespace executionGraph
             EXECGRAPH_THROW_IF(it == m_nonConstNodes.end(),
                                "Node with id: '{0}' does not exist in tree!",
                                nodeId);
-            // Add node to the group
-            it->second.m_groups.emplace(groupId);
-            m_nodeGroups[groupId].emplace(&it->second);
+            // Add node to the group (group ids are kept sorted).
+            auto& groups = it->second.m_groups;
+            auto pos     = std::lower_bound(groups.begin(), groups.end(), groupId);
+            if(pos != groups.end() && *pos == groupId)
+            {
+                return;
+            }
+            groups.insert(pos, groupId);
+            ++m_groupSpans[groupId].m_nodeCount;
 
             m_executionOrderUpToDate = false;
         }
@@ -344,8 +563,20 @@ namespace executionGraph
                                "Node with id: '{0}' or '{1}' does not exist!",
                                outN,
                                inN)
-            NodeBaseType::setGetLink(*outNit->second->m_node, outS, *inNit->second->m_node, inS);
+            // The parent of a replaced Get-Link might get a lower priority.
+            auto& inNode     = *inNit->second->m_node;
+            auto* outSocket  = inNode.hasISocket(inS) ? inNode.getISocket(inS).followGetLink() : nullptr;
+            auto* parentNode = outSocket ? &outSocket->getParent() : nullptr;
+
+            NodeBaseType::setGetLink(*outNit->second->m_node, outS, inNode, inS);
             m_executionOrderUpToDate = false;
+            // A replaced Get-Link might have made some output unreachable.
+            m_checkReachability = true;
+            onLinkAdded(outN, inN);
+            if(parentNode)
+            {
+                onLinkRemoved(parentNode->getId());
+            }
         }
 
         //! Removes a Get-Link to get the data from output socket at index `outS`
@@ -363,7 +594,7 @@ namespace executionGraph
 
             auto& node = *(nodeIt->second->m_node);
             // There is only one get link! Check
-            if(!outN && !outS && node.hasISocket(inS))
+            if(outN && outS && node.hasISocket(inS))
             {
                 auto* outSocket = node.getISocket(inS).followGetLink();
                 EXECGRAPH_THROW_TYPE_IF(!outSocket || (outSocket->getIndex() != *outS ||
@@ -378,9 +609,20 @@ namespace executionGraph
                                         *outS);
             }
 
+            // The former parent might get a lower priority after removal.
+            auto* outSocket  = node.hasISocket(inS) ? node.getISocket(inS).followGetLink() : nullptr;
+            auto* parentNode = outSocket ? &outSocket->getParent() : nullptr;
+
             node.removeGetLink(inS);
 
             m_executionOrderUpToDate = false;
+            m_checkReachability      = true;
+            m_danglingCheckNodes.emplace(inN);
+            markStale(inN);
+            if(parentNode)
+            {
+                onLinkRemoved(parentNode->getId());
+            }
         }
 
         //! Constructs a Write-Link to write the data of output socket at index
@@ -396,6 +638,7 @@ namespace executionGraph
             }
             NodeBaseType::addWriteLink(*outNit->second->m_node, outS, *inNit->second->m_node, inS);
             m_executionOrderUpToDate = false;
+            onLinkAdded(outN, inN);
         }
 
         //! Remove a Write-Link to write the data of output socket at index
@@ -411,6 +654,10 @@ namespace executionGraph
             }
             NodeBaseType::removeWriteLink(*outNit->second->m_node, outS, *inNit->second->m_node, inS);
             m_executionOrderUpToDate = false;
+            m_checkReachability      = true;
+            m_danglingCheckNodes.emplace(inN);
+            markStale(inN);
+            onLinkRemoved(outN);
         }
 
         //! Reset all nodes in group with id: `groupId`.
@@ -419,17 +666,19 @@ namespace executionGraph
             EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
                                "ExecutionTree's execution order is not up to date!");
             // Execute in determined order!
-            auto it = m_groupExecList.find(groupId);
-            EXECGRAPH_THROW_IF(it == m_groupExecList.end(),
+            auto it = m_groupSpans.find(groupId);
+            EXECGRAPH_THROW_IF(it == m_groupSpans.end(),
                                "ExecutionTree does not contain a group with id: '{0}'",
                                groupId);
-            executePrioritySet(it->second, [](NodeBaseType& node) { node.reset(); });
+            executeGroup(it->second, [this](ExecutionRecord& record) { resetRecord(record); });
+            // Nodes downstream of the group need to be recomputed as well.
+            markStale(it->second);
         }
 
         //! Reset the whole graph.
         void runReset()
         {
-            executePrioritySet(m_execList, [](NodeBaseType& node) { node.reset(); });
+            executePlan(m_plan, [this](ExecutionRecord& record) { resetRecord(record); });
         }
 
         //! Execute all nodes in group with id: `groupId` in their determined order.
@@ -438,11 +687,13 @@ namespace executionGraph
             EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
                                "ExecutionTree's execution order is not up to date!");
             // Execute in determined order!
-            auto it = m_groupExecList.find(groupId);
-            EXECGRAPH_THROW_IF(it == m_groupExecList.end(),
+            auto it = m_groupSpans.find(groupId);
+            EXECGRAPH_THROW_IF(it == m_groupSpans.end(),
                                "ExecutionTree does not contain a group with id: '{0}'",
                                groupId);
-            executePrioritySet(it->second, [](NodeBaseType& node) { node.compute(); });
+            applyWriteLinks();
+            // Parents outside of the group might still be stale.
+            executeGroup(it->second, [this](ExecutionRecord& record) { computeRecord(record, true); });
         }
 
         //! Execute the whole graph.
@@ -451,193 +702,1864 @@ namespace executionGraph
             EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
                                "ExecutionTree's execution order is not up to date!")
 
-            executePrioritySet(m_execList, [](NodeBaseType& node) { node.compute(); });
+            applyWriteLinks();
+            executePlan(m_plan, [this](ExecutionRecord& record) { computeRecord(record); });
         }
 
-        //! Setups the execution tree by building its execution order.
-        void setup(bool connectAllDanglingInputs = true, bool checkResults = false)
+        //! Apply all Write-Links of the graph in one pass over the compiled Write-Links.
+        //! Write-Links are applied in execution order, such that the last writer to an input socket wins.
+        //! Write-Links to input sockets with a Get-Link are not applied: such an input
+        //! is only redirected when a writer calls `setValue`.
+        //! This is skipped if the Write-Links have already been applied since the last `setup()`.
+        //! The execution functions call this before executing, nodes only need to call
+        //! `setValue` on their outputs to redirect an input socket with several writers.
+        void applyWriteLinks()
         {
-            // Allways check results in Debug mode.
-            EXECGRAPH_DEBUG_ONLY(checkResults = true;)
+            EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
+                               "ExecutionTree's execution order is not up to date!");
+            if(m_writeLinksApplied)
+            {
+                return;
+            }
+            for(const WriteLinkSlot& link : m_writeLinks)
+            {
+                *link.m_slot = link.m_src;
+            }
+            m_writeLinksApplied = true;
+        }
 
-            if(m_nodeClassifications[NodeClassification::OutputNode].size() == 0)
+        //! Execute only the nodes in the transitive input cone of node `nodeId` (including itself)
+        //! in their determined order. The cone's execution order is cached until the next `setup()`.
+        //! In lazy evaluation mode only stale nodes in the cone are computed.
+        void evaluate(NodeId nodeId)
+        {
+            EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
+                               "ExecutionTree's execution order is not up to date!");
+
+            auto it = m_conePlans.find(nodeId);
+            if(it == m_conePlans.end())
             {
-                EXECGRAPH_THROW("No output nodes specified!");
+                auto nodeIt = m_nonConstNodes.find(nodeId);
+                EXECGRAPH_THROW_IF(nodeIt == m_nonConstNodes.end(),
+                                   "Node with id: '{0}' does not exist in tree or is a constant node!",
+                                   nodeId);
+                it = m_conePlans.emplace(nodeId, ExecutionPlan{}).first;
+                compileConePlan(nodeIt->second, it->second);
             }
 
-            // Solve execution order globally over all groups!
-            // Each group has its own execution order based on the the global computed one!
-            ExecutionOrderSolver solver(m_nonConstNodes,
-                                        m_constNodes,
-                                        (connectAllDanglingInputs) ? m_nodeDefaultOutputPool : nullptr);
-            solver.solve(m_execList, m_groupExecList);
+            applyWriteLinks();
+            executePlan(it->second, [this](ExecutionRecord& record) {
+                char& stale = m_stale[record.m_globalIndex];
+                if(m_lazyEvaluation && !stale)
+                {
+                    return;
+                }
+                record.m_node->compute();
+                stale = false;
+            });
+        }
+
+        //! Capture the values of all output sockets into the compact binary snapshot `snapshot`.
+        //! If `delta` is `true`, only the values which changed since the last capture are recorded.
+        //! Values are compared in their encoded form with the last capture. After adding or removing
+        //! nodes, all values of nodes after the first changed node are recorded.
+        void captureValues(SocketValueSnapshot& snapshot, bool delta = false)
+        {
+            std::vector<std::uint8_t>& buffer = snapshot.getBuffer();
+            buffer.clear();
+            SocketValueWriter writer(buffer);
+
+            SocketValueSnapshot::Header header;
+            header.m_isDelta = delta;
+            header.m_nTypes  = meta::size<SocketTypes>::value;
+            writer.write(header);
+
+            m_snapshotEntriesNext.clear();
+            m_snapshotValuesNext.clear();
+            SocketValueWriter valueWriter(m_snapshotValuesNext);
 
-            // Check if each output node reaches at least one input, if not print warning!
-            ReachNodeCheck c;
-            for(auto* outNode : m_nodeClassifications[NodeClassification::OutputNode])
+            std::size_t cursor = 0;
+            for(auto& keyValue : m_nodes)
             {
-                bool outputReachedInput = false;
+                NodeBaseType& node          = *keyValue.second->m_node;
+                const std::size_t nodeBegin = buffer.size();
+                writer.write(static_cast<std::uint64_t>(node.getId()));
+                writer.write(std::uint32_t(0));  // Number of values (written below).
 
-                for(auto* inNode : m_nodeClassifications[NodeClassification::InputNode])
+                std::uint32_t count = 0;
+                for(auto& output : node.getOutputs())
                 {
-                    if(c.check(outNode, inNode))
+                    // Encode the value.
+                    const std::size_t begin = m_snapshotValuesNext.size();
+                    output->applyVisitor([&](auto& socket) {
+                        using DataType = typename std::decay_t<decltype(socket)>::DataType;
+                        SocketValueCodec<DataType>::write(valueWriter, socket.getValue());
+                    });
+                    const std::size_t size    = m_snapshotValuesNext.size() - begin;
+                    const std::uint8_t* value = m_snapshotValuesNext.data() + begin;
+                    m_snapshotEntriesNext.push_back({node.getId(), output->getIndex(), begin, size});
+
+                    bool changed = true;
+                    if(delta && cursor < m_snapshotEntries.size())
                     {
-                        outputReachedInput = true;
-                        break;
+                        const SnapshotEntry& last = m_snapshotEntries[cursor];
+                        changed                   = last.m_nodeId != node.getId() || last.m_socket != output->getIndex() ||
+                                                    last.m_size != size ||
+                                                    std::memcmp(m_snapshotValues.data() + last.m_offset, value, size) != 0;
+                    }
+                    ++cursor;
+
+                    if(changed)
+                    {
+                        writer.write(static_cast<std::uint32_t>(output->getIndex()));
+                        writer.write(static_cast<std::uint16_t>(output->getType()));
+                        writer.write(value, size);
+                        ++count;
                     }
                 }
-                EXECGRAPH_WARN(outputReachedInput,
-                               "Output node id: '{0}' did not reach any input!",
-                               outNode->getId());
+
+                if(count == 0)
+                {
+                    buffer.resize(nodeBegin);
+                    continue;
+                }
+                std::memcpy(buffer.data() + nodeBegin + sizeof(std::uint64_t), &count, sizeof(count));
+                ++header.m_nodeCount;
             }
+            std::memcpy(buffer.data(), &header, sizeof(header));
 
-            m_executionOrderUpToDate = true;
+            std::swap(m_snapshotEntries, m_snapshotEntriesNext);
+            std::swap(m_snapshotValues, m_snapshotValuesNext);
         }
 
-        //! Get execution order information.
-        std::string getExecutionOrderInfo(std::string suffix = "\t\t")
+        //! Restore the output socket values of the snapshot `snapshot` (see `captureValues`).
+        //! A delta snapshot needs to be restored on top of the snapshots it is based on.
+        //! Throws if the snapshot does not match this tree, values restored so far stay restored.
+        //! In lazy evaluation mode, all nodes downstream of the restored nodes are marked stale.
+        void restoreValues(const SocketValueSnapshot& snapshot)
         {
-            // Print execution order
-            std::stringstream s;
-            std::string fmtH = "  %-6s  | %-8s   |  %-20s\n";
-            std::string fmt  = "  %-6i  | %-8i   |  %-20s\n";
-            for(auto& g : m_groupExecList)
+            const SocketValueSnapshot::Header header = snapshot.getHeader();
+            EXECGRAPH_THROW_IF(header.m_nTypes != meta::size<SocketTypes>::value,
+                               "Snapshot has '{0}' socket types instead of '{1}'!",
+                               header.m_nTypes,
+                               meta::size<SocketTypes>::value);
+
+            const auto& data = snapshot.getData();
+            SocketValueReader reader(data.data() + sizeof(header), data.size() - sizeof(header));
+            for(std::uint64_t n = 0; n < header.m_nodeCount; ++n)
             {
-                s << "Execution order for group id: " << g.first << std::endl;
-                s << suffix << fmt::printf(fmtH, "NodeId", "Priority", "NodeType") << std::endl;
-                s << suffix << fmt::printf(fmtH, "------", "--------", "--------") << std::endl;
-                for(auto& p : g.second)
+                const NodeId nodeId       = reader.read<std::uint64_t>();
+                const std::uint32_t count = reader.read<std::uint32_t>();
+
+                auto it = m_nodes.find(nodeId);
+                EXECGRAPH_THROW_IF(it == m_nodes.end(),
+                                   "Snapshot contains node id: '{0}' which does not exist in tree!",
+                                   nodeId);
+                NodeBaseType& node = *it->second->m_node;
+
+                for(std::uint32_t i = 0; i < count; ++i)
+                {
+                    const SocketIndex index = reader.read<std::uint32_t>();
+                    const IndexType type    = reader.read<std::uint16_t>();
+                    EXECGRAPH_THROW_IF(!node.hasOSocket(index) || node.getOSocket(index).getType() != type,
+                                       "Snapshot value of output socket index: '{0}' of node id: '{1}' "
+                                       "does not match the socket!",
+                                       index,
+                                       nodeId);
+                    node.getOSocket(index).applyVisitor([&](auto& socket) {
+                        using DataType = typename std::decay_t<decltype(socket)>::DataType;
+                        SocketValueCodec<DataType>::read(reader, socket.getValue());
+                    });
+                }
+
+                if(m_lazyEvaluation)
                 {
-                    for(NodeData* nodeData : p.second)
+                    for(auto& output : node.getOutputs())
                     {
-                        auto* n = nodeData->m_node.get();
-                        s << suffix
-                          << fmt::printf(fmt, n->getId(), nodeData->m_priority, rttr::type::get(*n).get_name())
-                          << std::endl;
+                        for(auto* input : output->getGetterSockets())
+                        {
+                            markStale(input->getParent().getId());
+                        }
+                        for(auto* input : output->getWriteToSockets())
+                        {
+                            markStale(input->getParent().getId());
+                        }
                     }
                 }
-                s << suffix << fmt::printf(fmtH, "---------------", "------", "--------", "--------") << std::endl;
             }
-            return s.str();
+            EXECGRAPH_THROW_IF(!reader.atEnd(), "Snapshot contains trailing data!");
         }
 
-    protected:
-        //! Add a default pool.
-        void addDefaultOutputPool()
+        //! Enable/disable lazy evaluation.
+        //! In lazy evaluation mode `runExecute` only computes nodes which are dirty (see `markDirty`)
+        //! and which feed at least one output node. All other nodes keep their output values.
+        //! Enabling marks all nodes dirty.
+        void setLazyEvaluation(bool enable)
         {
-            auto id = std::numeric_limits<NodeId>::max();
-            // Make a default pool of output sockets.
-            auto p                  = std::make_unique<LogicNodeDefaultOutputs>(id);
-            m_nodeDefaultOutputPool = p.get();
-            addNode(std::move(p), NodeClassification::ConstantNode);
-            auto it = m_constNodes.find(id);
-            EXECGRAPH_THROW_IF(it == m_constNodes.end(), "Default pool not added!");
-            it->second.m_isAutoGenerated = true;
+            if(enable == m_lazyEvaluation)
+            {
+                return;
+            }
+            m_lazyEvaluation = enable;
+
+            if(enable && m_executionOrderUpToDate)
+            {
+                compileExecutionPlans();
+            }
+            m_stale.assign(m_stale.size(), true);
         }
 
-        //! Execute all nodes in PrioritySet.
-        template<typename Functor>
-        inline void executePrioritySet(PrioritySet& prioritySet, Functor&& func)
+        //! If lazy evaluation is enabled.
+        bool isLazyEvaluation() const { return m_lazyEvaluation; }
+
+        //! Mark the node with id `nodeId` dirty, because the values of its inputs
+        //! (or for input nodes, the values it produces) have changed.
+        //! The node and all nodes downstream are recomputed by the next `runExecute` in lazy evaluation mode.
+        void markDirty(NodeId nodeId)
         {
-            for(auto& p : prioritySet)
+            if(!m_lazyEvaluation)
             {
-                // Execute all nodes with this priority
-                for(NodeData* nodeData : p.second)
-                {
-                    func(*nodeData->m_node);
-                }
+                return;
             }
+            auto it = m_nonConstNodes.find(nodeId);
+            EXECGRAPH_THROW_IF(it == m_nonConstNodes.end(),
+                               "Node with id: '{0}' does not exist in tree!",
+                               nodeId);
+            markStale(it->second);
         }
 
-        class ExecutionSolverBase
+        //! Mark the input socket at index `inS` of node `nodeId` dirty, because its value changed.
+        void markDirty(NodeId nodeId, SocketIndex inS)
         {
-        public:
-            ExecutionSolverBase(ConstantNodeDataStorage& constantNodes,
-                                LogicNodeDefaultOutputs* defaultOutputSockets = nullptr)
-                : m_defaultOutputSockets(defaultOutputSockets), m_constNodes(constantNodes) {}
+            auto it = m_nodes.find(nodeId);
+            EXECGRAPH_THROW_IF(it == m_nodes.end() || !it->second->m_node->hasISocket(inS),
+                               "Node with id: '{0}' has no input socket '{1}'!",
+                               nodeId,
+                               inS);
+            markDirty(nodeId);
+        }
 
-            //! Connects all dangling input sockets to the default output socket.
-            void connectAllDanglingInputs(NodeData& nodeData)
+        //! Set the execution mode for `runExecute` and `runReset`.
+        //! For `ExecutionMode::ParallelLevels` a pool with `nThreads` threads (including the
+        //! calling thread) is used, `nThreads == 0` uses the hardware concurrency.
+        //! Nodes with the same priority are independent of each other in terms of Get-Links,
+        //! however the user is responsible that their `compute()` functions are thread-safe
+        //! with respect to each other (e.g. no two nodes of the same priority
+        //! Write-Link into the same input socket).
+        void setExecutionMode(ExecutionMode mode, std::size_t nThreads = 0)
+        {
+            m_executionMode = mode;
+            if(mode == ExecutionMode::Serial)
             {
-                // All input sockets need to be connected!
-                for(SocketInputBasePointer& inSocket : nodeData.m_node->getInputs())
-                {
-                    // Socket is dangling!
-                    if(inSocket->getConnectionCount() == 0)
-                    {
-                        EXECGRAPH_THROW_TYPE_IF(m_defaultOutputSockets == nullptr,
-                                                NodeConnectionException,
-                                                "Input socket index: '{0}' of node: '{1}' is dangling and cannot be connected to default output, since it is not set!",
-                                                inSocket->getIndex(),
-                                                nodeData.m_node->getId());
-                        m_defaultOutputSockets->connect(*inSocket);
-                    }
-                }
+                m_threadPool = nullptr;
+            }
+            else if(!m_threadPool || (nThreads != 0 && m_threadPool->getThreadCount() != nThreads))
+            {
+                m_threadPool = std::make_unique<ForkJoinPool>(nThreads);
             }
 
-            void checkResults(const NodeDataStorage& nodes)
+            if(mode == ExecutionMode::DataFlow && m_executionOrderUpToDate)
             {
-                auto check = [&](auto* socket, const NodeData& nodeDataWithLowerPrio) {
-                    // Get NodeData of parentNode
-                    auto& parentNode = socket->getParent();
+                compileExecutionPlans();
+            }
+        }
 
-                    // Check first if it is a constant node.
-                    auto itConstant = m_constNodes.find(parentNode.getId());
-                    if(itConstant != m_constNodes.end())
-                    {
-                        // nothing to check for constant nodes
-                        return;
-                    }
+        //! Get the current execution mode.
+        ExecutionMode getExecutionMode() const { return m_executionMode; }
 
-                    auto itParent = nodes.find(parentNode.getId());
-                    EXECGRAPH_THROW_IF(itParent == nodes.end(),
-                                       "Node with id: '{0}' has not been added to the execution tree!",
-                                       parentNode.getId());
-                    const NodeData& parentNodeData = itParent->second;
+        //! Set up the pipelined execution for `runPipelined`.
+        //! The global execution order is split into `nStages` stages of consecutive priority levels
+        //! with about the same number of nodes. Each output value which is consumed in a later stage
+        //! is buffered `nBuffers` times (at least double-buffered), which allows a stage to
+        //! run `nBuffers - 1` frames ahead of the stages consuming its values.
+        void setPipeline(std::size_t nStages, std::size_t nBuffers = 2)
+        {
+            EXECGRAPH_THROW_IF(nStages == 0 || nBuffers < 2,
+                               "A pipeline needs at least one stage and two buffers (stages: '{0}', buffers: '{1}')",
+                               nStages,
+                               nBuffers);
+            m_pipeline.m_nStages  = nStages;
+            m_pipeline.m_nBuffers = nBuffers;
+            m_pipeline.m_upToDate = false;
+        }
 
-                    EXECGRAPH_THROW_IF(parentNodeData.m_priority <= nodeDataWithLowerPrio.m_priority,
-                                       "Parent node id: '{0}' [prio: '{1}' ]"
-                                       "has not a higher priority as node id: '{2}' "
-                                       "which is wrong!",
-                                       parentNodeData.m_node->getId(),
-                                       parentNodeData.m_priority,
-                                       nodeDataWithLowerPrio.m_node->getId());
-                };
+        //! Execute the whole graph `nFrames` times, pipelined over the stages (see `setPipeline`).
+        //! Each stage runs on its own thread: while stage `s` computes frame `N`, stage `s+1` can still
+        //! compute frame `N-1`. An input socket reading a value from an earlier stage sees the buffered
+        //! value of the same frame, such that no node needs to be changed.
+        //! After the last stage has finished frame `N`, `onFrameFinished(N)` is called on its thread.
+        //! Only the values of the last stage (which contains all nodes without children,
+        //! e.g. the output nodes) belong to frame `N` during the call.
+        //! Write-Links between different stages are not supported, lazy evaluation is ignored.
+        template<typename Callback>
+        void runPipelined(std::size_t nFrames, Callback&& onFrameFinished)
+        {
+            EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
+                               "ExecutionTree's execution order is not up to date!");
 
-                for(auto& pair : nodes)
+            if(!m_pipeline.m_upToDate)
+            {
+                compilePipeline();
+            }
+            applyWriteLinks();
+
+            Pipeline& pipe            = m_pipeline;
+            const std::size_t nStages = pipe.m_stages.size();
+            if(!pipe.m_pool || pipe.m_pool->getThreadCount() != nStages)
+            {
+                pipe.m_pool = std::make_unique<ForkJoinPool>(nStages);
+            }
+
+            std::mutex mutex;
+            std::condition_variable cond;
+            std::vector<std::size_t> finished(nStages, 0);  // Finished frames of each stage.
+            bool abort = false;
+
+            auto runStage = [&](std::size_t s) {
+                PipelineStage& stage = pipe.m_stages[s];
+                try
                 {
-                    const NodeData& nodeData = pair.second;
-                    // Follow all links
-                    auto& inSockets = nodeData.m_node->getInputs();
-                    for(auto& socket : inSockets)
+                    for(std::size_t frame = 0; frame < nFrames; ++frame)
                     {
-                        // Try adding the get link to the stack
-                        if(socket->hasGetLink())
+                        // Wait for the values of this frame from the previous stage and
+                        // until the slot of this frame is no longer read by any consumer.
                         {
-                            check(socket->followGetLink(), nodeData);
+                            std::unique_lock<std::mutex> lock(mutex);
+                            cond.wait(lock, [&]() {
+                                return abort ||
+                                       ((s == 0 || finished[s - 1] > frame) &&
+                                        finished[stage.m_lastConsumer] + pipe.m_nBuffers > frame);
+                            });
+                            if(abort)
+                            {
+                                return;
+                            }
                         }
-                        // Try adding all writing links to the stack
-                        for(auto* outputSocket : socket->getWritingSockets())
+
+                        const std::size_t slot = frame % pipe.m_nBuffers;
+                        for(auto& input : stage.m_inputs)
                         {
-                            check(outputSocket, nodeData);
+                            input.m_input->setDataPointer(pipe.m_buffers[input.m_buffer].m_slots[slot].get());
                         }
-                    }
-                }
-            }
 
-        protected:
-            LogicNodeDefaultOutputs* m_defaultOutputSockets;  //!< Default output sockets which are used for all dangling input sockets.
-            ConstantNodeDataStorage& m_constNodes;            //!< Constant nodes which do not need evaluation.
-        };
+                        for(IndexType r = stage.m_recordsBegin; r < stage.m_recordsEnd; ++r)
+                        {
+                            m_plan.m_records[r].m_node->compute();
+                        }
 
-        //! The solver for computing the execution order.
-        class ExecutionOrderSolver : public ExecutionSolverBase
-        {
-        public:
-            ExecutionOrderSolver(NodeDataStorage& nodes,
-                                 ConstantNodeDataStorage& constantNodes,
+                        for(auto b : stage.m_outputs)
+                        {
+                            PipelineBuffer& buffer = pipe.m_buffers[b];
+                            buffer.m_ops->m_assign(buffer.m_slots[slot].get(), buffer.m_output->getDataPointer());
+                        }
+
+                        if(s + 1 == nStages)
+                        {
+                            onFrameFinished(frame);
+                        }
+
+                        {
+                            std::scoped_lock<std::mutex> lock(mutex);
+                            ++finished[s];
+                        }
+                        cond.notify_all();
+                    }
+                }
+                catch(...)
+                {
+                    {
+                        std::scoped_lock<std::mutex> lock(mutex);
+                        abort = true;
+                    }
+                    cond.notify_all();
+                    throw;
+                }
+            };
+
+            // Point all redirected input sockets back to the output values.
+            auto restoreInputs = [&]() {
+                for(auto& stage : pipe.m_stages)
+                {
+                    for(auto& input : stage.m_inputs)
+                    {
+                        input.m_input->setDataPointer(pipe.m_buffers[input.m_buffer].m_output->getDataPointer());
+                    }
+                }
+                m_writeLinksApplied = false;  // Redirected inputs might also have Write-Links.
+            };
+
+            try
+            {
+                pipe.m_pool->runOnAll(runStage);
+            }
+            catch(...)
+            {
+                restoreInputs();
+                throw;
+            }
+            restoreInputs();
+        }
+
+        //! Setups the execution tree by building its execution order.
+        //! If all edits since the last `setup()` went through the link and node functions of this
+        //! class, the priorities have already been adjusted incrementally and no full solve is needed.
+        void setup(bool connectAllDanglingInputs = true, bool checkResults = false)
+        {
+            // Allways check results in Debug mode.
+            EXECGRAPH_DEBUG_ONLY(checkResults = true;)
+
+            if(m_nodeClassifications[NodeClassification::OutputNode].size() == 0)
+            {
+                EXECGRAPH_THROW("No output nodes specified!");
+            }
+
+            LogicNodeDefaultOutputs* defaultOutputs = (connectAllDanglingInputs) ? m_nodeDefaultOutputPool : nullptr;
+
+            if(m_needsFullSolve)
+            {
+                // Solve execution order globally over all groups!
+                // Each group has its own execution order based on the the global computed one!
+                ExecutionOrderSolver solver(m_nonConstNodes, m_constNodes, m_solverState, defaultOutputs);
+                try
+                {
+                    solver.solve(m_execList);
+                }
+                catch(ExecutionGraphCycleException&)
+                {
+                    // Report all cycles and not only the first one found by the solver.
+                    std::vector<CycleDescription> cycles;
+                    findCycles(cycles);
+                    EXECGRAPH_THROW_TYPE(ExecutionGraphCycleException,
+                                         "Your execution logic graph contains '{0}' cycle(s): {1}",
+                                         cycles.size(),
+                                         getCyclesInfo(cycles));
+                }
+                m_needsFullSolve    = false;
+                m_checkReachability = true;
+                m_markAllStale      = true;  // Unknown edits might have happened.
+            }
+            else
+            {
+                // Priorities are up to date: only connect new dangling inputs
+                // and rebuild the execution lists.
+                ExecutionSolverBase solver(m_constNodes, defaultOutputs);
+                for(auto nodeId : m_danglingCheckNodes)
+                {
+                    auto it = m_nonConstNodes.find(nodeId);
+                    if(it != m_nonConstNodes.end())
+                    {
+                        solver.connectAllDanglingInputs(it->second);
+                        markStale(it->second);
+                    }
+                }
+                buildExecutionLists();
+
+                if(checkResults)
+                {
+                    solver.checkResults(m_nonConstNodes);
+                }
+            }
+            m_danglingCheckNodes.clear();
+
+            // Freeze the solved orders into contiguous execution plans.
+            compileExecutionPlans();
+            if(m_markAllStale)
+            {
+                m_stale.assign(m_stale.size(), true);
+                m_markAllStale = false;
+            }
+
+            if(m_checkReachability)
+            {
+                // Check if each output node reaches at least one input, if not print warning!
+                checkOutputsReachInputs();
+                m_checkReachability = false;
+            }
+
+            m_executionOrderUpToDate = true;
+        }
+
+        //! Check if node `a` influences node `b`, meaning `b` is reachable from `a` by
+        //! following Get-Links and Write-Links downstream (a node influences itself).
+        //! The reachability index is built on the first query after each `setup()`.
+        bool influences(NodeId a, NodeId b)
+        {
+            EXECGRAPH_THROW_IF(!m_executionOrderUpToDate,
+                               "ExecutionTree's execution order is not up to date!");
+
+            auto itA = m_nonConstNodes.find(a);
+            auto itB = m_nonConstNodes.find(b);
+            EXECGRAPH_THROW_IF(itA == m_nonConstNodes.end() || itB == m_nonConstNodes.end(),
+                               "Node with id: '{0}' or '{1}' does not exist in tree or is a constant node!",
+                               a,
+                               b);
+
+            if(!m_reachabilityUpToDate)
+            {
+                buildReachabilityIndex();
+            }
+            return m_reachability.reaches(itA->second.m_planIndex, itB->second.m_planIndex);
+        }
+
+        //! Find cycles in the graph (over Get-Links and Write-Links) and append them to `cycles`.
+        //! One cycle is reported for each strongly connected component with more than one node
+        //! (or a node linked to itself), since the number of all elementary cycles can be exponential.
+        //! Each cycle is a path `[link0, ..., linkN]` where `linkN` ends at the output node of `link0`.
+        //! Runs in O(nodes + links). Returns the number of cycles found.
+        std::size_t findCycles(std::vector<CycleDescription>& cycles)
+        {
+            static constexpr IndexType noIndex = std::numeric_limits<IndexType>::max();
+
+            // Dense indexing of all non-constant nodes.
+            m_cycleNodes.clear();
+            for(auto& keyValue : m_nonConstNodes)
+            {
+                keyValue.second.m_traversalIndex = m_cycleNodes.size();
+                m_cycleNodes.emplace_back(&keyValue.second);
+            }
+            const IndexType nNodes = m_cycleNodes.size();
+
+            // Compressed adjacency (parent to child) with the link of each edge.
+            m_cycleOffsets.assign(nNodes + 1, 0);
+            m_cycleSuccessors.clear();
+            m_cycleLinks.clear();
+            for(IndexType i = 0; i < nNodes; ++i)
+            {
+                forEachChildLink(*m_cycleNodes[i]->m_node, [&](NodeData& child, const SocketLinkDescription& link) {
+                    m_cycleSuccessors.emplace_back(child.m_traversalIndex);
+                    m_cycleLinks.emplace_back(link);
+                });
+                m_cycleOffsets[i + 1] = m_cycleSuccessors.size();
+            }
+
+            const IndexType nComponents = m_scc.compute(m_cycleOffsets, m_cycleSuccessors);
+
+            // A component is cyclic if it has an edge between two of its nodes.
+            // Remember one of its nodes as the start of the cycle.
+            m_cycleStart.assign(nComponents, noIndex);
+            for(IndexType i = 0; i < nNodes; ++i)
+            {
+                IndexType component = m_scc.getComponent(i);
+                for(auto e = m_cycleOffsets[i]; e < m_cycleOffsets[i + 1]; ++e)
+                {
+                    if(m_scc.getComponent(m_cycleSuccessors[e]) == component)
+                    {
+                        m_cycleStart[component] = i;
+                        break;
+                    }
+                }
+            }
+
+            // Breadth-first search inside each cyclic component back to its start node:
+            // the shortest cycle through the start node.
+            std::size_t nCycles = 0;
+            m_cyclePred.assign(nNodes, noIndex);
+            for(IndexType component = 0; component < nComponents; ++component)
+            {
+                const IndexType start = m_cycleStart[component];
+                if(start == noIndex)
+                {
+                    continue;
+                }
+
+                m_cycleQueue.clear();
+                m_cycleQueue.emplace_back(start);
+                IndexType lastEdge = noIndex;
+                for(IndexType q = 0; q < m_cycleQueue.size() && lastEdge == noIndex; ++q)
+                {
+                    IndexType n = m_cycleQueue[q];
+                    for(auto e = m_cycleOffsets[n]; e < m_cycleOffsets[n + 1]; ++e)
+                    {
+                        IndexType succ = m_cycleSuccessors[e];
+                        if(succ == start)
+                        {
+                            lastEdge = e;
+                            break;
+                        }
+                        if(m_scc.getComponent(succ) == component && m_cyclePred[succ] == noIndex)
+                        {
+                            m_cyclePred[succ] = e;
+                            m_cycleQueue.emplace_back(succ);
+                        }
+                    }
+                }
+                EXECGRAPH_ASSERT(lastEdge != noIndex, "No cycle found in a cyclic component!");
+
+                // Walk the predecessor edges back to the start node.
+                CycleDescription& cycle = cycles.emplace_back();
+                for(IndexType e = lastEdge;;)
+                {
+                    cycle.emplace_back(m_cycleLinks[e]);
+                    // The source node of edge `e`.
+                    IndexType n = std::upper_bound(m_cycleOffsets.begin(), m_cycleOffsets.end(), e) -
+                                  m_cycleOffsets.begin() - 1;
+                    if(n == start)
+                    {
+                        break;
+                    }
+                    e = m_cyclePred[n];
+                }
+                std::reverse(cycle.begin(), cycle.end());
+                ++nCycles;
+            }
+            return nCycles;
+        }
+
+        //! Check if adding the link `link` would create a cycle (over Get-Links and Write-Links).
+        //! If so and `cycle` is not `nullptr`, the cycle `[link, ...]` is stored in `cycle`.
+        //! While the priorities are up to date (see `setup()`) only nodes with a higher priority than
+        //! the output node of `link` are searched, which is usually a small part of the graph.
+        bool wouldCreateCycle(const SocketLinkDescription& link, CycleDescription* cycle = nullptr)
+        {
+            static constexpr IndexType noIndex = std::numeric_limits<IndexType>::max();
+
+            auto outIt = m_nonConstNodes.find(link.m_outNodeId);
+            auto inIt  = m_nonConstNodes.find(link.m_inNodeId);
+            if(outIt == m_nonConstNodes.end() || inIt == m_nonConstNodes.end())
+            {
+                return false;  // Links from/to constant nodes cannot be part of a cycle.
+            }
+            NodeData& outNode = outIt->second;
+            NodeData& inNode  = inIt->second;
+
+            const bool prune = !m_needsFullSolve;
+            if(prune && outNode.m_priority > inNode.m_priority && &outNode != &inNode)
+            {
+                return false;  // The order is already correct.
+            }
+
+            // Depth-first search downstream from `inNode` to `outNode`.
+            // Each search entry stores its node, the entry it was reached from and the link.
+            // `m_traversalIndex` points to the node's entry (valid if the entry points back).
+            m_cycleSearch.clear();
+            m_cycleStack.clear();
+            auto visit = [&](NodeData& nodeData, IndexType from, const SocketLinkDescription& l) {
+                IndexType idx = nodeData.m_traversalIndex;
+                if(idx < m_cycleSearch.size() && m_cycleSearch[idx].m_node == &nodeData)
+                {
+                    return;
+                }
+                nodeData.m_traversalIndex = m_cycleSearch.size();
+                m_cycleSearch.push_back({&nodeData, from, l});
+                m_cycleStack.emplace_back(nodeData.m_traversalIndex);
+            };
+
+            visit(inNode, noIndex, link);
+            IndexType found = (&outNode == &inNode) ? 0 : noIndex;
+
+            while(!m_cycleStack.empty() && found == noIndex)
+            {
+                IndexType idx = m_cycleStack.back();
+                m_cycleStack.pop_back();
+                forEachChildLink(*m_cycleSearch[idx].m_node->m_node, [&](NodeData& child, const SocketLinkDescription& l) {
+                    if(found != noIndex)
+                    {
+                        return;
+                    }
+                    if(&child == &outNode)
+                    {
+                        visit(child, idx, l);
+                        found = child.m_traversalIndex;
+                    }
+                    else if(!prune || child.m_priority > outNode.m_priority)
+                    {
+                        visit(child, idx, l);
+                    }
+                });
+            }
+
+            if(found == noIndex)
+            {
+                return false;
+            }
+
+            if(cycle)
+            {
+                // Links from `outNode` back to the new link.
+                cycle->clear();
+                for(IndexType idx = found; idx != noIndex; idx = m_cycleSearch[idx].m_from)
+                {
+                    cycle->emplace_back(m_cycleSearch[idx].m_link);
+                }
+                std::reverse(cycle->begin(), cycle->end());
+            }
+            return true;
+        }
+
+        //! Get execution order information.
+        std::string getExecutionOrderInfo(std::string suffix = "\t\t")
+        {
+            // Print execution order
+            std::stringstream s;
+            std::string fmtH = "  %-6s  | %-8s   |  %-20s\n";
+            std::string fmt  = "  %-6i  | %-8i   |  %-20s\n";
+            for(auto& g : m_groupSpans)
+            {
+                s << "Execution order for group id: " << g.first << std::endl;
+                s << suffix << fmt::printf(fmtH, "NodeId", "Priority", "NodeType") << std::endl;
+                s << suffix << fmt::printf(fmtH, "------", "--------", "--------") << std::endl;
+                for(IndexType idx : g.second.m_records)
+                {
+                    const ExecutionRecord& record = m_plan.m_records[idx];
+                    auto* n                       = record.m_node;
+                    s << suffix
+                      << fmt::printf(fmt, n->getId(), record.m_priority, rttr::type::get(*n).get_name())
+                      << std::endl;
+                }
+                s << suffix << fmt::printf(fmtH, "---------------", "------", "--------", "--------") << std::endl;
+            }
+            return s.str();
+        }
+
+    protected:
+        //! Add a default pool.
+        void addDefaultOutputPool()
+        {
+            auto id = std::numeric_limits<NodeId>::max();
+            // Make a default pool of output sockets.
+            auto p                  = createNode<LogicNodeDefaultOutputs>(id);
+            m_nodeDefaultOutputPool = p.get();
+            addNode(std::move(p), NodeClassification::ConstantNode);
+            auto it = m_constNodes.find(id);
+            EXECGRAPH_THROW_IF(it == m_constNodes.end(), "Default pool not added!");
+            it->second.m_isAutoGenerated = true;
+        }
+
+        //! Destroy all nodes (before the node memory they live in).
+        void clearNodes()
+        {
+            m_nodes.clear();
+            for(auto& nodes : m_nodeClassifications)
+            {
+                nodes.clear();
+            }
+            m_constNodes.clear();
+            m_nonConstNodes.clear();
+            m_nodeDefaultOutputPool = nullptr;
+        }
+
+        //! Call `func(NodeData&)` for each non-constant parent node of `node` (Get-Links and Write-Links).
+        template<typename Func>
+        void forEachParent(NodeBaseType& node, Func&& func)
+        {
+            auto visit = [&](SocketOutputBaseType& outputSocket) {
+                auto it = m_nonConstNodes.find(outputSocket.getParent().getId());
+                if(it != m_nonConstNodes.end())
+                {
+                    func(it->second);
+                }
+            };
+
+            for(auto& socket : node.getInputs())
+            {
+                if(socket->hasGetLink())
+                {
+                    visit(*socket->followGetLink());
+                }
+                for(auto* outputSocket : socket->getWritingSockets())
+                {
+                    visit(*outputSocket);
+                }
+            }
+        }
+
+        //! Call `func(NodeData&)` for each non-constant child node of `node` (Get-Links and Write-Links).
+        template<typename Func>
+        void forEachChild(NodeBaseType& node, Func&& func)
+        {
+            auto visit = [&](SocketInputBaseType& inputSocket) {
+                auto it = m_nonConstNodes.find(inputSocket.getParent().getId());
+                if(it != m_nonConstNodes.end())
+                {
+                    func(it->second);
+                }
+            };
+
+            for(auto& socket : node.getOutputs())
+            {
+                for(auto* inputSocket : socket->getGetterSockets())
+                {
+                    visit(*inputSocket);
+                }
+                for(auto* inputSocket : socket->getWriteToSockets())
+                {
+                    visit(*inputSocket);
+                }
+            }
+        }
+
+        //! Call `func(NodeData&, const SocketLinkDescription&)` for each link to a non-constant child node of `node`.
+        template<typename Func>
+        void forEachChildLink(NodeBaseType& node, Func&& func)
+        {
+            auto visit = [&](SocketOutputBaseType& outputSocket, SocketInputBaseType& inputSocket, bool isWriteLink) {
+                auto it = m_nonConstNodes.find(inputSocket.getParent().getId());
+                if(it != m_nonConstNodes.end())
+                {
+                    func(it->second, SocketLinkDescription{node.getId(),
+                                                           outputSocket.getIndex(),
+                                                           inputSocket.getParent().getId(),
+                                                           inputSocket.getIndex(),
+                                                           isWriteLink});
+                }
+            };
+
+            for(auto& socket : node.getOutputs())
+            {
+                for(auto* inputSocket : socket->getGetterSockets())
+                {
+                    visit(*socket, *inputSocket, false);
+                }
+                for(auto* inputSocket : socket->getWriteToSockets())
+                {
+                    visit(*socket, *inputSocket, true);
+                }
+            }
+        }
+
+        //! Get the node ids of all cycles `cycles` as string.
+        static std::string getCyclesInfo(const std::vector<CycleDescription>& cycles)
+        {
+            std::stringstream ss;
+            for(auto& cycle : cycles)
+            {
+                ss << "[ ";
+                for(auto& link : cycle)
+                {
+                    ss << link.m_outNodeId << (link.m_isWriteLink ? " <-- " : " --> ");
+                }
+                ss << (cycle.empty() ? "" : std::to_string(cycle.front().m_outNodeId)) << " ] ";
+            }
+            return ss.str();
+        }
+
+        //! Incrementally adjust the priorities for the new node `nodeData`, which might already have links.
+        void onNodeAdded(NodeData& nodeData)
+        {
+            m_danglingCheckNodes.emplace(nodeData.m_node->getId());
+            if(m_needsFullSolve)
+            {
+                return;
+            }
+
+            NodeBaseType& node = *nodeData.m_node;
+            forEachParent(node, [&](NodeData& parent) {
+                if(!m_needsFullSolve && !raisePriorities(parent, nodeData))
+                {
+                    m_needsFullSolve = true;
+                }
+            });
+            forEachChild(node, [&](NodeData& child) {
+                if(!m_needsFullSolve && !raisePriorities(nodeData, child))
+                {
+                    m_needsFullSolve = true;
+                }
+            });
+        }
+
+        //! Incrementally adjust the priorities for a new link from node `outN` to node `inN`.
+        void onLinkAdded(NodeId outN, NodeId inN)
+        {
+            markStale(inN);
+
+            if(m_needsFullSolve)
+            {
+                return;
+            }
+
+            auto outIt = m_nonConstNodes.find(outN);
+            auto inIt  = m_nonConstNodes.find(inN);
+            if(outIt == m_nonConstNodes.end() || inIt == m_nonConstNodes.end())
+            {
+                return;  // Links from/to constant nodes do not influence the priorities.
+            }
+
+            if(!raisePriorities(outIt->second, inIt->second))
+            {
+                // A cycle: the full solve in `setup()` reports it.
+                m_needsFullSolve = true;
+            }
+        }
+
+        //! Raise the priorities of `parent` and all its ancestors (only where needed) such that
+        //! `parent` is executed before `child`. Only the affected upstream cone is visited.
+        //! Returns `false` if `child` is an ancestor of `parent` (a cycle), the priorities are then inconsistent.
+        bool raisePriorities(NodeData& parent, NodeData& child)
+        {
+            if(parent.m_priority > child.m_priority)
+            {
+                return true;
+            }
+
+            m_raiseStack.clear();
+            parent.m_priority = child.m_priority + 1;
+            m_raiseStack.emplace_back(&parent);
+
+            bool cycle = false;
+            while(!m_raiseStack.empty() && !cycle)
+            {
+                NodeData* nodeData = m_raiseStack.back();
+                m_raiseStack.pop_back();
+
+                forEachParent(*nodeData->m_node, [&](NodeData& p) {
+                    if(&p == &child)
+                    {
+                        cycle = true;
+                    }
+                    else if(p.m_priority <= nodeData->m_priority)
+                    {
+                        p.m_priority = nodeData->m_priority + 1;
+                        m_raiseStack.emplace_back(&p);
+                    }
+                });
+            }
+            return !cycle;
+        }
+
+        //! Incrementally adjust the priorities after a link from node `outN` has been removed.
+        void onLinkRemoved(NodeId outN)
+        {
+            if(m_needsFullSolve)
+            {
+                return;
+            }
+
+            auto outIt = m_nonConstNodes.find(outN);
+            if(outIt != m_nonConstNodes.end())
+            {
+                lowerPriorities(outIt->second);
+            }
+        }
+
+        //! Lower the priority of `nodeData` and all its ancestors (only where possible) such that
+        //! each node is again exactly one above its highest child (or zero without children).
+        //! Only the affected upstream cone is visited. The priorities need to be consistent.
+        void lowerPriorities(NodeData& nodeData)
+        {
+            auto priorityFromChildren = [&](NodeData& n) {
+                IndexType priority = 0;
+                forEachChild(*n.m_node, [&](NodeData& child) {
+                    priority = std::max(priority, child.m_priority + 1);
+                });
+                return priority;
+            };
+
+            m_raiseStack.clear();
+            m_raiseStack.emplace_back(&nodeData);
+            while(!m_raiseStack.empty())
+            {
+                NodeData* n = m_raiseStack.back();
+                m_raiseStack.pop_back();
+
+                IndexType priority = priorityFromChildren(*n);
+                if(priority < n->m_priority)
+                {
+                    n->m_priority = priority;
+                    forEachParent(*n->m_node, [&](NodeData& p) { m_raiseStack.emplace_back(&p); });
+                }
+            }
+        }
+
+        //! Build the global execution list from the (valid) priorities of all nodes.
+        void buildExecutionLists()
+        {
+            m_execList.clear();
+            for(auto& keyValue : m_nonConstNodes)
+            {
+                NodeData* nodeData = &keyValue.second;
+                m_execList[nodeData->m_priority].emplace_back(nodeData);
+            }
+        }
+
+        //! Compile the global execution order into the execution plan and the group spans.
+        void compileExecutionPlans()
+        {
+            // Assign the global plan indices and carry over the stale flags.
+            std::vector<char> stale;
+            stale.reserve(m_nonConstNodes.size());
+            for(auto& p : m_execList)
+            {
+                for(NodeData* nodeData : p.second)
+                {
+                    IndexType oldIndex = nodeData->m_planIndex;
+                    stale.emplace_back(oldIndex < m_stale.size() ? m_stale[oldIndex] : true);
+                    nodeData->m_planIndex = stale.size() - 1;
+                }
+            }
+            m_stale = std::move(stale);
+
+            compileExecutionPlan(m_execList, m_plan);
+
+            compileGroupSpans();
+            compileWriteLinks();
+
+            m_conePlans.clear();
+            m_reachabilityUpToDate = false;
+            m_pipeline.m_upToDate  = false;
+
+            if(m_lazyEvaluation)
+            {
+                compileFeedsOutput();
+            }
+        }
+
+        //! Compile all Write-Links of the graph into one flat array in execution order
+        //! (Write-Links of constant nodes first). The global plan needs to be compiled.
+        void compileWriteLinks()
+        {
+            m_writeLinks.clear();
+            auto addWriteLinks = [&](NodeBaseType& node) {
+                for(auto& output : node.getOutputs())
+                {
+                    // Outputs whose targets have only this writer need not forward their values in `setValue`.
+                    // Inputs with a Get-Link are only redirected by `setValue` of a writer.
+                    bool batched = true;
+                    for(auto* input : output->getWriteToSockets())
+                    {
+                        if(input->hasGetLink())
+                        {
+                            batched = false;
+                            continue;
+                        }
+                        m_writeLinks.push_back({input->getDataPointerSlot(), output->getDataPointer()});
+                        batched = batched && input->getWritingSockets().size() == 1;
+                    }
+                    output->setWriteLinksBatched(batched);
+                }
+            };
+
+            for(auto& keyValue : m_constNodes)
+            {
+                addWriteLinks(*keyValue.second.m_node);
+            }
+            for(ExecutionRecord& record : m_plan.m_records)
+            {
+                addWriteLinks(*record.m_node);
+            }
+            m_writeLinksApplied = false;
+        }
+
+        //! Compile the execution order of each group as a view into the global execution plan.
+        //! The global plan needs to be compiled.
+        void compileGroupSpans()
+        {
+            for(auto& g : m_groupSpans)
+            {
+                g.second.m_records.clear();
+                g.second.m_levelOffsets.clear();
+            }
+
+            for(auto& p : m_execList)
+            {
+                for(NodeData* nodeData : p.second)
+                {
+                    for(GroupId groupId : nodeData->m_groups)
+                    {
+                        GroupSpan& span = m_groupSpans[groupId];
+                        if(span.m_records.empty() || m_plan.m_records[span.m_records.back()].m_priority != p.first)
+                        {
+                            span.m_levelOffsets.emplace_back(span.m_records.size());  // New level.
+                        }
+                        span.m_records.emplace_back(nodeData->m_planIndex);
+                    }
+                }
+            }
+
+            for(auto& g : m_groupSpans)
+            {
+                g.second.m_levelOffsets.emplace_back(g.second.m_records.size());
+            }
+        }
+
+        //! Compile the execution plan `plan` of the transitive input cone of node `nodeData`.
+        void compileConePlan(NodeData& nodeData, ExecutionPlan& plan)
+        {
+            PrioritySet cone;
+            std::unordered_set<NodeData*> visited{&nodeData};
+            std::vector<NodeData*> stack{&nodeData};
+            while(!stack.empty())
+            {
+                NodeData* n = stack.back();
+                stack.pop_back();
+                cone[n->m_priority].emplace_back(n);
+
+                forEachParent(*n->m_node, [&](NodeData& parent) {
+                    if(visited.emplace(&parent).second)
+                    {
+                        stack.emplace_back(&parent);
+                    }
+                });
+            }
+            compileExecutionPlan(cone, plan);
+        }
+
+        //! Warn for each output node which is not reachable from any input node.
+        //! Single sweep over the global execution order (parents before children).
+        void checkOutputsReachInputs()
+        {
+            std::vector<char> reachesInput(m_plan.m_records.size(), false);
+            for(auto& p : m_execList)
+            {
+                for(NodeData* nodeData : p.second)
+                {
+                    char reaches = nodeData->m_class == NodeClassification::InputNode;
+                    forEachParent(*nodeData->m_node, [&](NodeData& parent) {
+                        reaches = reaches || reachesInput[parent.m_planIndex];
+                    });
+                    reachesInput[nodeData->m_planIndex] = reaches;
+
+                    EXECGRAPH_WARN(reaches || nodeData->m_class != NodeClassification::OutputNode,
+                                   "Output node id: '{0}' did not reach any input!",
+                                   nodeData->m_node->getId());
+                }
+            }
+        }
+
+        //! Get the pipeline buffer operations for the socket type with index `type`.
+        template<typename... T>
+        static const PipelineBufferOps& getPipelineBufferOps(IndexType type, meta::list<T...>)
+        {
+            static const std::array<PipelineBufferOps, sizeof...(T)> ops = {{PipelineBufferOps{
+                [](void const* value) -> std::shared_ptr<void> {
+                    if constexpr(std::is_copy_constructible<T>::value)
+                    {
+                        return std::make_shared<T>(*static_cast<T const*>(value));
+                    }
+                    else
+                    {
+                        EXECGRAPH_THROW("Values of type '{0}' cannot be buffered between pipeline stages (not copyable)!",
+                                        demangle<T>());
+                    }
+                },
+                [](void* dest, void const* value) {
+                    if constexpr(std::is_copy_assignable<T>::value)
+                    {
+                        *static_cast<T*>(dest) = *static_cast<T const*>(value);
+                    }
+                    else
+                    {
+                        EXECGRAPH_THROW("Values of type '{0}' cannot be buffered between pipeline stages (not assignable)!",
+                                        demangle<T>());
+                    }
+                }}...}};
+            return ops[type];
+        }
+
+        //! Compile the pipeline stages and buffers over the global execution plan.
+        void compilePipeline()
+        {
+            Pipeline& pipe = m_pipeline;
+            pipe.m_stages.clear();
+            pipe.m_buffers.clear();
+
+            const IndexType nRecords = m_plan.m_records.size();
+            const IndexType nLevels  = m_plan.m_levelOffsets.size() - 1;
+            const IndexType nStages  = std::max<IndexType>(1, std::min<IndexType>(pipe.m_nStages, nLevels));
+
+            // Split the levels into stages with about the same number of records.
+            std::vector<IndexType> stageOfRecord(nRecords);
+            IndexType level = 0;
+            for(IndexType s = 0; s < nStages; ++s)
+            {
+                PipelineStage& stage = pipe.m_stages.emplace_back();
+                stage.m_recordsBegin = m_plan.m_levelOffsets[level];
+                stage.m_lastConsumer = s;
+
+                // At least one level, and one level left for each following stage.
+                const IndexType target = (nRecords * (s + 1)) / nStages;
+                do
+                {
+                    ++level;
+                } while(level < nLevels - (nStages - 1 - s) && m_plan.m_levelOffsets[level] < target);
+
+                stage.m_recordsEnd = m_plan.m_levelOffsets[level];
+                std::fill(stageOfRecord.begin() + stage.m_recordsBegin, stageOfRecord.begin() + stage.m_recordsEnd, s);
+            }
+
+            auto getStage = [&](SocketInputBaseType& input) {
+                auto it = m_nonConstNodes.find(input.getParent().getId());
+                EXECGRAPH_ASSERT(it != m_nonConstNodes.end(), "Child node is not part of the execution order!");
+                return stageOfRecord[it->second.m_planIndex];
+            };
+
+            // Buffer all outputs read in later stages.
+            for(IndexType s = 0; s < nStages; ++s)
+            {
+                for(IndexType r = pipe.m_stages[s].m_recordsBegin; r < pipe.m_stages[s].m_recordsEnd; ++r)
+                {
+                    for(auto& output : m_plan.m_records[r].m_node->getOutputs())
+                    {
+                        for(auto* input : output->getWriteToSockets())
+                        {
+                            EXECGRAPH_THROW_IF(getStage(*input) != s,
+                                               "Write-Link from node id: '{0}' to node id: '{1}' crosses pipeline stages!",
+                                               output->getParent().getId(),
+                                               input->getParent().getId());
+                        }
+
+                        IndexType buffer = std::numeric_limits<IndexType>::max();
+                        for(auto* input : output->getGetterSockets())
+                        {
+                            IndexType t = getStage(*input);
+                            if(t == s)
+                            {
+                                continue;
+                            }
+
+                            if(buffer == std::numeric_limits<IndexType>::max())
+                            {
+                                buffer            = pipe.m_buffers.size();
+                                PipelineBuffer& b = pipe.m_buffers.emplace_back();
+                                b.m_output        = output.get();
+                                b.m_ops           = &getPipelineBufferOps(output->getType(), SocketTypes{});
+                                for(std::size_t i = 0; i < pipe.m_nBuffers; ++i)
+                                {
+                                    b.m_slots.emplace_back(b.m_ops->m_create(output->getDataPointer()));
+                                }
+                                pipe.m_stages[s].m_outputs.emplace_back(buffer);
+                            }
+
+                            pipe.m_stages[t].m_inputs.push_back({input, buffer});
+                            pipe.m_stages[s].m_lastConsumer = std::max(pipe.m_stages[s].m_lastConsumer, t);
+                        }
+                    }
+                }
+            }
+
+            pipe.m_upToDate = true;
+        }
+
+        //! Build the reachability index over the global execution plan.
+        void buildReachabilityIndex()
+        {
+            const IndexType nRecords = m_plan.m_records.size();
+            std::vector<IndexType> offsets(nRecords + 1, 0);
+            std::vector<IndexType> successors;
+            std::vector<IndexType> levels(nRecords);
+            for(IndexType i = 0; i < nRecords; ++i)
+            {
+                ExecutionRecord& record = m_plan.m_records[i];
+                levels[i]               = record.m_priority;
+                forEachChild(*record.m_node, [&](NodeData& child) {
+                    successors.emplace_back(child.m_planIndex);
+                });
+                offsets[i + 1] = successors.size();
+            }
+            m_reachability.build(std::move(offsets), std::move(successors), std::move(levels));
+            m_reachabilityUpToDate = true;
+        }
+
+        //! Determine for each node in the global plan if it feeds an output node.
+        void compileFeedsOutput()
+        {
+            m_feedsOutput.assign(m_plan.m_records.size(), false);
+            // Reverse execution order: all children are visited before their parents.
+            for(auto it = m_plan.m_records.rbegin(); it != m_plan.m_records.rend(); ++it)
+            {
+                auto nodeIt = m_nonConstNodes.find(it->m_node->getId());
+                char feeds  = nodeIt->second.m_class == NodeClassification::OutputNode;
+                forEachChild(*it->m_node, [&](NodeData& child) {
+                    feeds = feeds || m_feedsOutput[child.m_planIndex];
+                });
+                m_feedsOutput[it->m_globalIndex] = feeds;
+            }
+        }
+
+        //! Mark the node with id `nodeId` (if it is non-constant) and all nodes downstream as stale.
+        void markStale(NodeId nodeId)
+        {
+            auto it = m_nonConstNodes.find(nodeId);
+            if(it != m_nonConstNodes.end())
+            {
+                markStale(it->second);
+            }
+        }
+
+        //! Mark the node `nodeData` and all nodes downstream as stale (only in lazy evaluation mode).
+        void markStale(NodeData& nodeData)
+        {
+            if(!m_lazyEvaluation)
+            {
+                return;
+            }
+
+            // Nodes not yet in the plan are stale anyway, but their children need to be marked.
+            std::unordered_set<NodeData*> visitedNew;
+            m_staleStack.clear();
+            m_staleStack.emplace_back(&nodeData);
+            while(!m_staleStack.empty())
+            {
+                NodeData* n = m_staleStack.back();
+                m_staleStack.pop_back();
+
+                if(n->m_planIndex < m_stale.size())
+                {
+                    if(m_stale[n->m_planIndex])
+                    {
+                        continue;  // Downstream is already stale.
+                    }
+                    m_stale[n->m_planIndex] = true;
+                }
+                else if(!visitedNew.emplace(n).second)
+                {
+                    continue;
+                }
+
+                forEachChild(*n->m_node, [&](NodeData& child) { m_staleStack.emplace_back(&child); });
+            }
+        }
+
+        //! Compute the node of the record `record` (if needed in lazy evaluation mode).
+        //! If `checkParents` is `true`, the node stays stale if one of its parents is still stale
+        //! (only needed if not all parents are executed before, e.g. for groups).
+        inline void computeRecord(ExecutionRecord& record, bool checkParents = false)
+        {
+            char& stale = m_stale[record.m_globalIndex];
+            if(m_lazyEvaluation && !(stale && m_feedsOutput[record.m_globalIndex]))
+            {
+                return;
+            }
+            record.m_node->compute();
+            // All children of a stale node are stale, so they stay stale as well.
+            stale = m_lazyEvaluation && checkParents && hasStaleParent(*record.m_node);
+        }
+
+        //! Check if any parent of the node `node` is stale.
+        bool hasStaleParent(NodeBaseType& node)
+        {
+            bool stale = false;
+            forEachParent(node, [&](NodeData& parent) {
+                stale = stale || (parent.m_planIndex < m_stale.size() && m_stale[parent.m_planIndex]);
+            });
+            return stale;
+        }
+
+        //! Reset the node of the record `record`.
+        inline void resetRecord(ExecutionRecord& record)
+        {
+            record.m_node->reset();
+            m_stale[record.m_globalIndex] = true;
+        }
+
+        //! Mark all nodes of the group span `span` and all nodes downstream as stale.
+        void markStale(const GroupSpan& span)
+        {
+            if(!m_lazyEvaluation)
+            {
+                return;
+            }
+            for(IndexType index : span.m_records)
+            {
+                auto it = m_nonConstNodes.find(m_plan.m_records[index].m_node->getId());
+                EXECGRAPH_ASSERT(it != m_nonConstNodes.end(), "Node not in tree!");
+                m_stale[index] = false;  // Such that `markStale` visits the nodes downstream.
+                markStale(it->second);
+            }
+        }
+
+        //! Compile the execution order `prioritySet` into the execution plan `plan`.
+        //! The global plan indices need to be assigned.
+        void compileExecutionPlan(PrioritySet& prioritySet, ExecutionPlan& plan)
+        {
+            plan = ExecutionPlan{};
+
+            for(auto& p : prioritySet)
+            {
+                plan.m_levelOffsets.emplace_back(plan.m_records.size());
+                for(NodeData* nodeData : p.second)
+                {
+                    NodeBaseType* node = nodeData->m_node.get();
+
+                    ExecutionRecord record;
+                    record.m_node        = node;
+                    record.m_globalIndex = nodeData->m_planIndex;
+                    record.m_priority    = nodeData->m_priority;
+                    record.m_inputsBegin = plan.m_inputData.size();
+                    for(auto& socket : node->getInputs())
+                    {
+                        plan.m_inputData.emplace_back(socket->getDataPointerAddress());
+                    }
+                    record.m_inputsEnd    = plan.m_inputData.size();
+                    record.m_outputsBegin = plan.m_outputData.size();
+                    for(auto& socket : node->getOutputs())
+                    {
+                        plan.m_outputData.emplace_back(socket->getDataPointer());
+                    }
+                    record.m_outputsEnd = plan.m_outputData.size();
+
+                    plan.m_records.emplace_back(record);
+                }
+            }
+            plan.m_levelOffsets.emplace_back(plan.m_records.size());
+
+            if(m_executionMode == ExecutionMode::DataFlow)
+            {
+                compileDependencies(plan);
+            }
+        }
+
+        //! Compile the dependency counts of the execution plan `plan` for `ExecutionMode::DataFlow`.
+        //! Only links between nodes inside the plan are dependencies.
+        void compileDependencies(ExecutionPlan& plan)
+        {
+            const IndexType nRecords = plan.m_records.size();
+
+            std::unordered_map<const NodeBaseType*, IndexType> indices;
+            for(IndexType i = 0; i < nRecords; ++i)
+            {
+                indices.emplace(plan.m_records[i].m_node, i);
+            }
+
+            plan.m_inDegree.assign(nRecords, 0);
+            plan.m_successorOffsets.assign(nRecords + 1, 0);
+
+            // Collect all distinct (parent, child) edges.
+            std::vector<std::pair<IndexType, IndexType>> edges;
+            std::vector<IndexType> parents;
+            for(IndexType child = 0; child < nRecords; ++child)
+            {
+                parents.clear();
+                auto addParent = [&](const NodeBaseType& parent) {
+                    auto it = indices.find(&parent);
+                    if(it != indices.end())
+                    {
+                        parents.emplace_back(it->second);
+                    }
+                };
+
+                for(auto& socket : plan.m_records[child].m_node->getInputs())
+                {
+                    if(socket->hasGetLink())
+                    {
+                        addParent(socket->followGetLink()->getParent());
+                    }
+                    for(auto* writingSocket : socket->getWritingSockets())
+                    {
+                        addParent(writingSocket->getParent());
+                    }
+                }
+
+                std::sort(parents.begin(), parents.end());
+                parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+
+                plan.m_inDegree[child] = parents.size();
+                for(auto parent : parents)
+                {
+                    edges.emplace_back(parent, child);
+                    ++plan.m_successorOffsets[parent + 1];
+                }
+                if(parents.empty())
+                {
+                    plan.m_roots.emplace_back(child);
+                }
+            }
+
+            std::partial_sum(plan.m_successorOffsets.begin(),
+                             plan.m_successorOffsets.end(),
+                             plan.m_successorOffsets.begin());
+
+            plan.m_successors.resize(edges.size());
+            std::vector<IndexType> fill(plan.m_successorOffsets.begin(), plan.m_successorOffsets.end() - 1);
+            for(auto& edge : edges)
+            {
+                plan.m_successors[fill[edge.first]++] = edge.second;
+            }
+
+            plan.m_pending = std::make_unique<std::atomic<IndexType>[]>(nRecords);
+            plan.m_ready.reserve(nRecords);
+        }
+
+        //! Prefetch the node and the socket data of the record `recordIdx` in `plan`.
+        static inline void prefetchRecord(const ExecutionPlan& plan, IndexType recordIdx)
+        {
+            const ExecutionRecord& record = plan.m_records[recordIdx];
+            EXECGRAPH_PREFETCH(record.m_node);
+            for(auto i = record.m_inputsBegin; i < record.m_inputsEnd; ++i)
+            {
+                EXECGRAPH_PREFETCH(*plan.m_inputData[i]);
+            }
+            for(auto i = record.m_outputsBegin; i < record.m_outputsEnd; ++i)
+            {
+                EXECGRAPH_PREFETCH(plan.m_outputData[i]);
+            }
+        }
+
+        //! Execute all nodes in the execution plan `plan` in the current execution mode.
+        template<typename Functor>
+        inline void executePlan(ExecutionPlan& plan, Functor&& func)
+        {
+            switch(m_executionMode)
+            {
+                case ExecutionMode::Serial:
+                {
+                    const IndexType nRecords = plan.m_records.size();
+                    for(IndexType i = 0; i < nRecords; ++i)
+                    {
+                        if(i + 1 < nRecords)
+                        {
+                            prefetchRecord(plan, i + 1);
+                        }
+                        func(plan.m_records[i]);
+                    }
+                    break;
+                }
+                case ExecutionMode::ParallelLevels:
+                {
+                    for(std::size_t l = 0; l + 1 < plan.m_levelOffsets.size(); ++l)
+                    {
+                        // Execute all nodes with this priority in parallel (barrier at the end).
+                        ExecutionRecord* records = plan.m_records.data() + plan.m_levelOffsets[l];
+                        m_threadPool->parallelFor(plan.m_levelOffsets[l + 1] - plan.m_levelOffsets[l],
+                                                  [&](std::size_t i) { func(records[i]); });
+                    }
+                    break;
+                }
+                case ExecutionMode::DataFlow:
+                {
+                    executeDataFlow(plan, func);
+                    break;
+                }
+            }
+        }
+
+        //! Execute all records of the group span `span` in the current execution mode.
+        //! The parallel modes execute the group level by level: the dependency counting
+        //! of `ExecutionMode::DataFlow` is only compiled for the global execution plan.
+        template<typename Functor>
+        inline void executeGroup(GroupSpan& span, Functor&& func)
+        {
+            ExecutionRecord* records = m_plan.m_records.data();
+            const IndexType* indices = span.m_records.data();
+
+            if(m_executionMode == ExecutionMode::Serial)
+            {
+                const IndexType nRecords = span.m_records.size();
+                for(IndexType i = 0; i < nRecords; ++i)
+                {
+                    if(i + 1 < nRecords)
+                    {
+                        prefetchRecord(m_plan, indices[i + 1]);
+                    }
+                    func(records[indices[i]]);
+                }
+                return;
+            }
+
+            for(std::size_t l = 0; l + 1 < span.m_levelOffsets.size(); ++l)
+            {
+                // Execute all nodes with this priority in parallel (barrier at the end).
+                const IndexType* level = indices + span.m_levelOffsets[l];
+                m_threadPool->parallelFor(span.m_levelOffsets[l + 1] - span.m_levelOffsets[l],
+                                          [&](std::size_t i) { func(records[level[i]]); });
+            }
+        }
+
+        //! Execute all nodes in the execution plan `plan` by dependency counting on the thread pool.
+        //! Each thread executes a ready node, decrements the pending counters of its successors
+        //! and continues directly with one successor which became ready (others are queued).
+        template<typename Functor>
+        void executeDataFlow(ExecutionPlan& plan, Functor& func)
+        {
+            const IndexType nRecords = plan.m_records.size();
+            if(nRecords == 0)
+            {
+                return;
+            }
+
+            for(IndexType i = 0; i < nRecords; ++i)
+            {
+                plan.m_pending[i].store(plan.m_inDegree[i], std::memory_order_relaxed);
+            }
+            plan.m_ready.assign(plan.m_roots.begin(), plan.m_roots.end());
+
+            static constexpr IndexType noRecord = std::numeric_limits<IndexType>::max();
+
+            std::mutex mutex;                            // Guards `plan.m_ready` and `abort`.
+            std::condition_variable readyCV;             // Signals new ready records or termination.
+            std::atomic<IndexType> remaining(nRecords);  // Number of not yet finished records.
+            bool abort = false;
+
+            m_threadPool->runOnAll([&](std::size_t) {
+                try
+                {
+                    IndexType next = noRecord;
+                    while(true)
+                    {
+                        IndexType idx = next;
+                        if(idx == noRecord)
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            readyCV.wait(lock, [&]() {
+                                return abort || !plan.m_ready.empty() || remaining.load() == 0;
+                            });
+                            if(abort || plan.m_ready.empty())
+                            {
+                                return;
+                            }
+                            idx = plan.m_ready.back();
+                            plan.m_ready.pop_back();
+                        }
+
+                        func(plan.m_records[idx]);
+
+                        // Release all successors.
+                        next             = noRecord;
+                        IndexType queued = 0;
+                        for(auto k = plan.m_successorOffsets[idx]; k < plan.m_successorOffsets[idx + 1]; ++k)
+                        {
+                            IndexType succ = plan.m_successors[k];
+                            if(plan.m_pending[succ].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                            {
+                                if(next == noRecord)
+                                {
+                                    next = succ;
+                                }
+                                else
+                                {
+                                    std::scoped_lock<std::mutex> lock(mutex);
+                                    plan.m_ready.emplace_back(succ);
+                                    ++queued;
+                                }
+                            }
+                        }
+
+                        if(queued > 1)
+                        {
+                            readyCV.notify_all();
+                        }
+                        else if(queued == 1)
+                        {
+                            readyCV.notify_one();
+                        }
+
+                        if(remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        {
+                            // Last record finished: wake up all waiting threads.
+                            {
+                                std::scoped_lock<std::mutex> lock(mutex);
+                            }
+                            readyCV.notify_all();
+                            return;
+                        }
+                    }
+                }
+                catch(...)
+                {
+                    {
+                        std::scoped_lock<std::mutex> lock(mutex);
+                        abort = true;
+                    }
+                    readyCV.notify_all();
+                    throw;
+                }
+            });
+        }
+
+        //! Dense working state of the solvers over all non-constant nodes (structure of arrays).
+        //! Kept in the tree such that repeated full solves do not allocate.
+        struct SolverState
+        {
+            enum Flags : std::uint8_t
+            {
+                Visited          = 1 << 0,  //!< All visited nodes (globally)
+                OnCurrentDFRPath = 1 << 1   //!< This mark is set for all nodes on the current depth-first recursion path.
+            };
+
+            std::vector<NodeData*> m_nodeDatas;      //!< Node data of each dense index.
+            std::vector<std::uint8_t> m_flags;       //!< Traversal flags of each node.
+            std::vector<IndexType> m_priorities;     //!< Priority of each node.
+            std::vector<IndexType> m_parentOffsets;  //!< Offsets into `m_parents` for each node.
+            std::vector<IndexType> m_parents;        //!< Non-constant parent nodes of all nodes (compressed).
+            std::vector<IndexType> m_dfrStack;       //!< Depth-First-Search Stack.
+        };
+
+        class ExecutionSolverBase
+        {
+        public:
+            ExecutionSolverBase(ConstantNodeDataStorage& constantNodes,
+                                LogicNodeDefaultOutputs* defaultOutputSockets = nullptr)
+                : m_defaultOutputSockets(defaultOutputSockets), m_constNodes(constantNodes) {}
+
+            //! Connects all dangling input sockets to the default output socket.
+            void connectAllDanglingInputs(NodeData& nodeData)
+            {
+                // All input sockets need to be connected!
+                for(SocketInputBasePointer& inSocket : nodeData.m_node->getInputs())
+                {
+                    // Socket is dangling!
+                    if(inSocket->getConnectionCount() == 0)
+                    {
+                        EXECGRAPH_THROW_TYPE_IF(m_defaultOutputSockets == nullptr,
+                                                NodeConnectionException,
+                                                "Input socket index: '{0}' of node: '{1}' is dangling and cannot be connected to default output, since it is not set!",
+                                                inSocket->getIndex(),
+                                                nodeData.m_node->getId());
+                        m_defaultOutputSockets->connect(*inSocket);
+                    }
+                }
+            }
+
+            void checkResults(const NodeDataStorage& nodes)
+            {
+                auto check = [&](auto* socket, const NodeData& nodeDataWithLowerPrio) {
+                    // Get NodeData of parentNode
+                    auto& parentNode = socket->getParent();
+
+                    // Check first if it is a constant node.
+                    auto itConstant = m_constNodes.find(parentNode.getId());
+                    if(itConstant != m_constNodes.end())
+                    {
+                        // nothing to check for constant nodes
+                        return;
+                    }
+
+                    auto itParent = nodes.find(parentNode.getId());
+                    EXECGRAPH_THROW_IF(itParent == nodes.end(),
+                                       "Node with id: '{0}' has not been added to the execution tree!",
+                                       parentNode.getId());
+                    const NodeData& parentNodeData = itParent->second;
+
+                    EXECGRAPH_THROW_IF(parentNodeData.m_priority <= nodeDataWithLowerPrio.m_priority,
+                                       "Parent node id: '{0}' [prio: '{1}' ]"
+                                       "has not a higher priority as node id: '{2}' "
+                                       "which is wrong!",
+                                       parentNodeData.m_node->getId(),
+                                       parentNodeData.m_priority,
+                                       nodeDataWithLowerPrio.m_node->getId());
+                };
+
+                for(auto& pair : nodes)
+                {
+                    const NodeData& nodeData = pair.second;
+                    // Follow all links
+                    auto& inSockets = nodeData.m_node->getInputs();
+                    for(auto& socket : inSockets)
+                    {
+                        // Try adding the get link to the stack
+                        if(socket->hasGetLink())
+                        {
+                            check(socket->followGetLink(), nodeData);
+                        }
+                        // Try adding all writing links to the stack
+                        for(auto* outputSocket : socket->getWritingSockets())
+                        {
+                            check(outputSocket, nodeData);
+                        }
+                    }
+                }
+            }
+
+        protected:
+            //! Build the dense solver state `state` over all non-constant nodes `nodes`:
+            //! each node gets its dense index in `NodeData::m_traversalIndex`, the flags are reset,
+            //! the priorities are reset and the parents are gathered in compressed form.
+            //! After this, the solvers only run over contiguous memory.
+            void buildSolverState(NodeDataStorage& nodes, SolverState& state)
+            {
+                state.m_nodeDatas.clear();
+                for(auto& keyValue : nodes)
+                {
+                    keyValue.second.m_traversalIndex = state.m_nodeDatas.size();
+                    state.m_nodeDatas.emplace_back(&keyValue.second);
+                }
+
+                const IndexType nNodes = state.m_nodeDatas.size();
+                state.m_flags.assign(nNodes, 0);
+                state.m_priorities.resize(nNodes);
+                state.m_parentOffsets.resize(nNodes + 1);
+                state.m_parents.clear();
+                state.m_dfrStack.clear();
+
+                auto addParent = [&](auto* socket) {
+                    auto& parentNode = socket->getParent();
+                    auto itParent    = nodes.find(parentNode.getId());
+                    if(itParent == nodes.end())
+                    {
+                        EXECGRAPH_ASSERT(m_constNodes.find(parentNode.getId()) != m_constNodes.end(),
+                                         "Parent node with id: '{0}' is not a constant node!",
+                                         parentNode.getId());
+                        return;
+                    }
+                    state.m_parents.emplace_back(itParent->second.m_traversalIndex);
+                };
+
+                for(IndexType idx = 0; idx < nNodes; ++idx)
+                {
+                    NodeData& nodeData         = *state.m_nodeDatas[idx];
+                    state.m_priorities[idx]    = 0;
+                    state.m_parentOffsets[idx] = state.m_parents.size();
+
+                    for(auto& socket : nodeData.m_node->getInputs())
+                    {
+                        if(socket->hasGetLink())
+                        {
+                            addParent(socket->followGetLink());
+                        }
+                        for(auto* outputSocket : socket->getWritingSockets())
+                        {
+                            addParent(outputSocket);
+                        }
+                    }
+                }
+                state.m_parentOffsets[nNodes] = state.m_parents.size();
+            }
+
+            //! Write the priorities of the solver state back to the nodes and make the priority set.
+            //! The groups execute views into the global execution order (see `compileGroupSpans`).
+            void storePriorities(const SolverState& state, PrioritySet& prioritiesGlobal)
+            {
+                for(IndexType idx = 0; idx < state.m_nodeDatas.size(); ++idx)
+                {
+                    NodeData* nodeData   = state.m_nodeDatas[idx];
+                    nodeData->m_priority = state.m_priorities[idx];
+                    prioritiesGlobal[nodeData->m_priority].emplace_back(nodeData);
+                }
+            }
+
+            //! Return current DFS stack, but only nodes which are on the current DFR path.
+            static std::string getTraversalInfo(const SolverState& state)
+            {
+                std::stringstream ss;
+                bool first = true;
+                for(IndexType idx : state.m_dfrStack)
+                {
+                    if(state.m_flags[idx] & SolverState::OnCurrentDFRPath)
+                    {
+                        ss << (first ? "" : " ---> ") << state.m_nodeDatas[idx]->m_node->getId();
+                        first = false;
+                    }
+                }
+                return ss.str();
+            }
+
+            //! Return current DFS stack, visited nodes are marked with "*".
+            static std::string getStackInfo(const SolverState& state)
+            {
+                std::stringstream ss;
+                ss << "[ ";
+                for(IndexType idx : state.m_dfrStack)
+                {
+                    ss << state.m_nodeDatas[idx]->m_node->getId()
+                       << ((state.m_flags[idx] & SolverState::Visited) ? "*" : " ") << ", ";
+                }
+                ss << " ]";
+                return ss.str();
+            }
+
+        protected:
+            LogicNodeDefaultOutputs* m_defaultOutputSockets;  //!< Default output sockets which are used for all dangling input sockets.
+            ConstantNodeDataStorage& m_constNodes;            //!< Constant nodes which do not need evaluation.
+        };
+
+        //! The solver for computing the execution order.
+        class ExecutionOrderSolver : public ExecutionSolverBase
+        {
+        public:
+            ExecutionOrderSolver(NodeDataStorage& nodes,
+                                 ConstantNodeDataStorage& constantNodes,
+                                 SolverState& state,
                                  LogicNodeDefaultOutputs* defaultOutputSockets = nullptr)
-                : ExecutionSolverBase(constantNodes, defaultOutputSockets), m_nonConstNodes(nodes)
+                : ExecutionSolverBase(constantNodes, defaultOutputSockets), m_nonConstNodes(nodes), m_state(state)
             {
             }
 
@@ -647,116 +2569,90 @@ namespace executionGraph
             This algorithm is based on https://en.wikipedia.org/wiki/Topological_sorting#Depth-first_search.
             We visit each node once during this algorithm.
             From each node `a` in `nodes` we start a depth-first recursion (DFR), basically exploring the whole subtree `S`
-            of each node `a`. While exploring, we set the NodeData::m_priority of each node in the subtree with root = `a`.
+            of each node `a`. While exploring, we set the priority of each node in the subtree with root = `a`.
 
-            For each DFR, we trace the current path explored by marking each node by the flag NodeData::OnCurrentDFRPath.
+            For each DFR, we trace the current path explored by marking each node by the flag SolverState::OnCurrentDFRPath.
             This allows to detect cycles.
 
-            When a node is visited its NodeData::Visited flag gets set.
-            A DFR starts only from a node which has NodeData::Visited == false.
-            During a DFR, a new child node is explored (added to the m_dfrStack) only if
+            When a node is visited its SolverState::Visited flag gets set.
+            A DFR starts only from a node which has SolverState::Visited == false.
+            During a DFR, a new child node is explored (added to the DFR stack) only if
             its priority is not greater than the parent.
-            When the child node is added the flag NodeData::Visited is unset!
+            When the child node is added the flag SolverState::Visited is unset!
+
+            The traversal runs over the dense solver state (see `buildSolverState`).
         */
-            void solve(PrioritySet& prioritiesGlobal,
-                       GroupExecutionList& prioritiesPerGroup,
-                       bool checkResults = true)
+            void solve(PrioritySet& prioritiesGlobal, bool checkResults = true)
             {
-                prioritiesPerGroup.clear();
                 prioritiesGlobal.clear();
 
-                //! @todo Find a good stack size depending on tree height.
-                m_dfrStack.reserve(10);
+                this->buildSolverState(m_nonConstNodes, m_state);
+                auto& flags            = m_state.m_flags;
+                auto& dfrStack         = m_state.m_dfrStack;
+                const IndexType nNodes = m_state.m_nodeDatas.size();
 
                 // Remove all nodes up the stack which are visited
                 // while doing so unmark the nodes.
                 auto doBackTracking = [&]() {
-                    auto itStart = m_dfrStack.rbegin();
-                    auto itEnd   = m_dfrStack.rend();
-                    auto it      = itStart;
-                    while(it != itEnd)
+                    auto it = dfrStack.end();
+                    while(it != dfrStack.begin() && (flags[*(it - 1)] & SolverState::Visited))
                     {
-                        if(!(*it)->isFlagSet(NodeData::Visited))
-                        {
-                            // Not visited, backtracking finished!
-                            // Remove the range [itStart,itLast) from the stack
-                            break;
-                        }
-                        (*it)->unsetFlag(NodeData::OnCurrentDFRPath);  // Remove Mark
-                        ++it;
+                        --it;
+                        flags[*it] &= ~SolverState::OnCurrentDFRPath;  // Remove Mark
                     }
-                    EXECGRAPH_ASSERT(std::distance(itStart, it) <= static_cast<typename decltype(m_dfrStack)::difference_type>(m_dfrStack.size()),
-                                     "Removing: '{0}' from '{1}'",
-                                     std::distance(itStart, it),
-                                     m_dfrStack.size());
-                    // Convert backward iterator to forward
-                    m_dfrStack.erase(it.base(), itStart.base());
+                    dfrStack.erase(it, dfrStack.end());
                 };
 
                 // Loop over all nodes and start a depth-first-search
-                for(auto& keyValue : m_nonConstNodes)
+                for(IndexType root = 0; root < nNodes; ++root)
                 {
-                    NodeData* nodeData = &keyValue.second;
                     // If the node is visited we know that the node was contained in a depth-first recursion
                     // we know that the prioriteis below it are correct, so skip this one
-                    if(nodeData->isFlagSet(NodeData::Visited))
+                    if(flags[root] & SolverState::Visited)
                     {
                         EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Start: Node id: '{0}'  already visited -> skip it.",
-                                                      nodeData->m_node->getId());
+                                                      m_state.m_nodeDatas[root]->m_node->getId());
                         continue;
                     }
 
                     EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Start: Node id: '{0}'",
-                                                  nodeData->m_node->getId());
+                                                  m_state.m_nodeDatas[root]->m_node->getId());
 
                     // Start a depth-first recursion from this node (exploring its subtree)
-                    m_dfrStack.clear();
-                    // Insert root node
-                    m_dfrStack.push_back(nodeData);
+                    dfrStack.clear();
+                    dfrStack.push_back(root);
 
-                    // Loop variables
-                    NodeData* currentNode;
-                    std::size_t currentSize;
-
-                    while(!m_dfrStack.empty())
+                    while(!dfrStack.empty())
                     {
-                        EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Stack: {0}", getStackInfo());
+                        EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Stack: {0}", this->getStackInfo(m_state));
 
-                        currentNode = m_dfrStack.back();
-                        currentSize = m_dfrStack.size();
+                        const IndexType currentNode   = dfrStack.back();
+                        const std::size_t currentSize = dfrStack.size();
 
                         // We are doing depth first search and try to visit a node which is already on the
                         // current DFR path.
-                        EXECGRAPH_THROW_TYPE_IF(currentNode->isFlagSet(NodeData::OnCurrentDFRPath),
+                        EXECGRAPH_THROW_TYPE_IF(flags[currentNode] & SolverState::OnCurrentDFRPath,
                                                 ExecutionGraphCycleException,
                                                 "Your execution logic graph contains a cycle! "
-                                                "Current traversal stack: '{0}'");
+                                                "Current traversal stack: '{0}'",
+                                                this->getTraversalInfo(m_state));
 
-                        visit(*currentNode);  // Visits neighbors and add them to m_dfrStack
+                        visit(currentNode);  // Visits neighbors and add them to the stack
 
                         // If no nodes have been added, down traversal is finished, we do now backtracking
-                        if(currentSize == m_dfrStack.size())
+                        if(currentSize == dfrStack.size())
                         {
                             doBackTracking();  // Removing all visited nodes up the stack
                         }
                     }
                 }
 
-                // Loop over all nodes and make priority sets:
-                for(auto& keyValue : m_nonConstNodes)
-                {
-                    NodeData* nodeData = &keyValue.second;
-
-                    nodeData->resetTraversalParameters();
-
-                    prioritiesGlobal[nodeData->m_priority].emplace_back(nodeData);
-                    // Put the nodes into PrioritySets for each Group
-                    for(auto& groupId : nodeData->m_groups)
-                    {
-                        prioritiesPerGroup[groupId][nodeData->m_priority].emplace_back(nodeData);
-                    }
+                // Store the priorities and make priority sets.
+                this->storePriorities(m_state, prioritiesGlobal);
 
-                    // Connect all dangling input sockets.
+                // Connect all dangling input sockets.
+                for(NodeData* nodeData : m_state.m_nodeDatas)
+                {
                     ExecutionSolverBase::connectAllDanglingInputs(*nodeData);
                 }
 
@@ -768,97 +2664,37 @@ namespace executionGraph
             }
 
         private:
-            //! Return current DFS stack, but only nodes which are on the current DFR path.
-            std::string getTraversalInfo()
-            {
-                std::stringstream ss;
-                auto it = m_dfrStack.begin();
-                if(it != m_dfrStack.end() && (*it)->isFlagSet(NodeData::OnCurrentDFRPath))
-                {
-                    ss << (*(it++))->m_node->getId();
-                }
-                for(; it != m_dfrStack.end(); ++it)
-                {
-                    if((*it)->isFlagSet(NodeData::OnCurrentDFRPath))
-                    {
-                        ss << " ---> " << (*it)->m_node->getId();
-                    }
-                }
-                return ss.str();
-            }
-
-            //! Return current DFS stack, visited nodes are marked with "*".
-            std::string getStackInfo()
-            {
-                std::stringstream ss;
-                ss << "[ ";
-                for(auto* nodeData : m_dfrStack)
-                {
-                    ss << nodeData->m_node->getId() << (nodeData->isFlagSet(NodeData::Visited) ? "*" : " ") << ", ";
-                }
-                ss << " ]";
-                return ss.str();
-            }
-
             /**
              * This is the visit function during Depth-First-Search,
-             * It adds nodes to the dfsStack if the priority is lower then the one of `nodeData`.
+             * It adds nodes to the dfsStack if the priority is lower then the one of `node`.
              */
-            void visit(NodeData& nodeData)
+            void visit(IndexType node)
             {
-                EXECGRAPH_EXECTREE_SOLVER_LOG("visit: '{0}'", nodeData.m_node->getId());
-
-                auto addParentsToStack = [&](auto* socket) {
-                    // Get NodeData of parentNode
-                    auto& parentNode = socket->getParent();
-                    auto itParent    = m_nonConstNodes.find(parentNode.getId());
-                    if(itParent == m_nonConstNodes.end())
-                    {
-                        EXECGRAPH_ASSERT(this->m_constNodes.find(parentNode.getId()) != this->m_constNodes.end(),
-                                         "Parent node with id: '{0}' is not a constant node!",
-                                         parentNode.getId());
-                        return;
-                    }
-
-                    NodeData* parentNodeData = &itParent->second;
+                EXECGRAPH_EXECTREE_SOLVER_LOG("visit: '{0}'", m_state.m_nodeDatas[node]->m_node->getId());
 
-                    if(parentNodeData->m_priority <= nodeData.m_priority)
-                    {
-                        // Parent needs a other priority (because its computation becomes before nodeData)
-                        parentNodeData->m_priority = nodeData.m_priority + 1;
-                        parentNodeData->unsetFlag(NodeData::Visited);
-                        m_dfrStack.push_back(parentNodeData);  // Add to stack and explore its subgraph
-                    }
-                };
+                auto& priorities         = m_state.m_priorities;
+                const IndexType priority = priorities[node];
 
                 // Follow all links
-                auto& inSockets = nodeData.m_node->getInputs();
-                for(auto& socket : inSockets)
+                const IndexType end = m_state.m_parentOffsets[node + 1];
+                for(IndexType k = m_state.m_parentOffsets[node]; k < end; ++k)
                 {
-                    // Try adding the get link to the stack
-                    if(socket->hasGetLink())
+                    const IndexType parent = m_state.m_parents[k];
+                    if(priorities[parent] <= priority)
                     {
-                        addParentsToStack(socket->followGetLink());
-                    }
-                    // Try adding all writing links to the stack
-                    for(auto* outputSocket : socket->getWritingSockets())
-                    {
-                        addParentsToStack(outputSocket);
+                        // Parent needs a other priority (because its computation becomes before node)
+                        priorities[parent] = priority + 1;
+                        m_state.m_flags[parent] &= ~SolverState::Visited;
+                        m_state.m_dfrStack.push_back(parent);  // Add to stack and explore its subgraph
                     }
                 }
 
-                // Mark this node as on the current depth-first recursion path
-                nodeData.setFlag(NodeData::OnCurrentDFRPath);
-
-                // Mark this node as visited
-                nodeData.setFlag(NodeData::Visited);
+                // Mark this node as on the current depth-first recursion path and as visited.
+                m_state.m_flags[node] |= SolverState::OnCurrentDFRPath | SolverState::Visited;
             }
 
-            bool m_inputReachable     = false;
-            NodeBaseType* m_reachNode = nullptr;
             NodeDataStorage& m_nonConstNodes;  //!< All NodeDatas of the execution tree.
-
-            std::vector<NodeData*> m_dfrStack;  //!< Depth-First-Search Stack
+            SolverState& m_state;              //!< The dense solver state.
         };
 
         //! First computes a topological order and then assigns priorities.
@@ -867,96 +2703,75 @@ namespace executionGraph
         public:
             ExecutionOrderSolver2(NodeDataStorage& nodes,
                                   ConstantNodeDataStorage& constantNodes,
+                                  SolverState& state,
                                   LogicNodeDefaultOutputs* defaultOutputSockets = nullptr)
-                : ExecutionSolverBase(constantNodes, defaultOutputSockets), m_nonConstNodes(nodes)
+                : ExecutionSolverBase(constantNodes, defaultOutputSockets), m_nonConstNodes(nodes), m_state(state)
             {
             }
 
-            void solve(PrioritySet& prioritiesGlobal,
-                       GroupExecutionList& prioritiesPerGroup,
-                       bool checkResults = true)
+            void solve(PrioritySet& prioritiesGlobal, bool checkResults = true)
             {
-                prioritiesPerGroup.clear();
                 prioritiesGlobal.clear();
 
-                //! @todo Find a good stack size depending on tree height.
-                m_dfrStack.reserve(10);
-                NodeDataList topoSortList;
-                topoSortList.reserve(10);
+                this->buildSolverState(m_nonConstNodes, m_state);
+                auto& flags            = m_state.m_flags;
+                auto& dfrStack         = m_state.m_dfrStack;
+                const IndexType nNodes = m_state.m_nodeDatas.size();
+
+                std::vector<IndexType> topoSortList;
+                topoSortList.reserve(nNodes);
 
                 // Remove all nodes up the stack which are visited
                 // while doing so unmark the nodes.
                 auto doBackTracking = [&]() {
-                    auto itStart = m_dfrStack.rbegin();
-                    auto itEnd   = m_dfrStack.rend();
-                    auto it      = itStart;
-                    while(it != itEnd)
+                    auto it = dfrStack.end();
+                    while(it != dfrStack.begin() && (flags[*(it - 1)] & SolverState::Visited))
                     {
-                        if(!(*it)->isFlagSet(NodeData::Visited))
-                        {
-                            // Not visited, backtracking finished!
-                            // Remove the range [itStart,itLast) from the stack
-                            break;
-                        }
-
+                        --it;
                         // If the node is marked unmark and add it to the topoSortList
-                        if((*it)->isFlagSet(NodeData::OnCurrentDFRPath))
+                        if(flags[*it] & SolverState::OnCurrentDFRPath)
                         {
                             topoSortList.push_back(*it);
-                            (*it)->unsetFlag(NodeData::OnCurrentDFRPath);
+                            flags[*it] &= ~SolverState::OnCurrentDFRPath;
                         }
-
-                        // Goto next node
-                        ++it;
                     }
-                    EXECGRAPH_ASSERT(std::distance(itStart, it) <= m_dfrStack.size(),
-                                     "Removing: '{0}' from '{1}'",
-                                     std::distance(itStart, it),
-                                     m_dfrStack.size());
-                    // Convert backward iterator to forward
-                    m_dfrStack.erase(it.base(), itStart.base());
+                    dfrStack.erase(it, dfrStack.end());
                 };
 
                 // Loop over all nodes and start a depth-first-search
-                for(auto& keyValue : m_nonConstNodes)
+                for(IndexType root = 0; root < nNodes; ++root)
                 {
-                    NodeData* nodeData = &keyValue.second;
-
-                    EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Start: Node id: '{0}'", nodeData->m_node->getId());
+                    EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Start: Node id: '{0}'", m_state.m_nodeDatas[root]->m_node->getId());
                     // Skip visited nodes.
-                    if(nodeData->isFlagSet(NodeData::Visited))
+                    if(flags[root] & SolverState::Visited)
                     {
                         continue;
                     }
 
                     // Start a depth-first recursion from this node (exploring this subtree)
-                    m_dfrStack.clear();
-                    // Insert root node
-                    m_dfrStack.push_back(nodeData);
+                    dfrStack.clear();
+                    dfrStack.push_back(root);
 
-                    NodeData* currentNode;
-                    std::size_t currentSize;
-
-                    while(!m_dfrStack.empty())
+                    while(!dfrStack.empty())
                     {
-                        EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Stack: {0}", getStackInfo());
+                        EXECGRAPH_EXECTREE_SOLVER_LOG("DFS Stack: {0}", this->getStackInfo(m_state));
 
-                        currentNode = m_dfrStack.back();
+                        const IndexType currentNode = dfrStack.back();
 
                         // We are doing depth first search and found another already visited node
                         // meaning we have a cycle.
-                        EXECGRAPH_THROW_TYPE_IF(currentNode->isFlagSet(NodeData::OnCurrentDFRPath),
+                        EXECGRAPH_THROW_TYPE_IF(flags[currentNode] & SolverState::OnCurrentDFRPath,
                                                 ExecutionGraphCycleException,
                                                 "Your execution logic graph contains a cycle! "
                                                 "Current traversal stack: '{0}'",
-                                                getTraversalInfo());
+                                                this->getTraversalInfo(m_state));
 
-                        currentNode->setFlag(NodeData::OnCurrentDFRPath);
-                        currentSize = m_dfrStack.size();
-                        visit(*currentNode);  // Visits neighbors and add them to m_dfrStack
+                        flags[currentNode] |= SolverState::OnCurrentDFRPath;
+                        const std::size_t currentSize = dfrStack.size();
+                        visit(currentNode);  // Visits neighbors and add them to the stack
 
                         // If no nodes have been added, down traversal is finished, we do now backtracking
-                        if(currentSize == m_dfrStack.size())
+                        if(currentSize == dfrStack.size())
                         {
                             doBackTracking();  // Removing all visited nodes up the stack
                         }
@@ -965,24 +2780,13 @@ namespace executionGraph
 
                 // Topological sort finished
                 // Traverse the sorted list from the back and assign the priorities
-
-                auto rEndIt = topoSortList.rend();
-                for(auto nodeDataIt = topoSortList.rbegin(); nodeDataIt != rEndIt; ++nodeDataIt)
+                for(auto it = topoSortList.rbegin(); it != topoSortList.rend(); ++it)
                 {
-                    NodeData* nodeData = *nodeDataIt;
-                    assignPrioritiesToChilds(*nodeData);
-                    ExecutionSolverBase::connectAllDanglingInputs(*nodeData);
+                    assignPrioritiesToParents(*it);
+                    ExecutionSolverBase::connectAllDanglingInputs(*m_state.m_nodeDatas[*it]);
                 }
 
-                for(NodeData* nodeData : topoSortList)
-                {
-                    prioritiesGlobal[nodeData->m_priority].emplace_back(nodeData);
-                    // Put the nodes into PrioritySets for each Group
-                    for(auto& groupId : nodeData->m_groups)
-                    {
-                        prioritiesPerGroup[groupId][nodeData->m_priority].emplace_back(nodeData);
-                    }
-                }
+                this->storePriorities(m_state, prioritiesGlobal);
 
                 // Check execution order by checking all inputs of all nodes
                 if(checkResults)
@@ -992,199 +2796,125 @@ namespace executionGraph
             }
 
         private:
-            //! Return current DFS stack, but only nodes which are on the current DFR path.
-            std::string getTraversalInfo()
-            {
-                std::stringstream ss;
-                auto it = m_dfrStack.begin();
-                if(it != m_dfrStack.end() && (*it)->isFlagSet(NodeData::OnCurrentDFRPath))
-                {
-                    ss << (*(it++))->m_node->getId();
-                }
-                for(; it != m_dfrStack.end(); ++it)
-                {
-                    if((*it)->isFlagSet(NodeData::OnCurrentDFRPath))
-                    {
-                        ss << " ---> " << (*it)->m_node->getId();
-                    }
-                }
-                return ss.str();
-            }
-
-            //! Return current DFS stack, visited nodes are marked with "*".
-            std::string getStackInfo()
-            {
-                std::stringstream ss;
-                ss << "[ ";
-                for(auto* nodeData : m_dfrStack)
-                {
-                    ss << nodeData->m_node->getId() << (nodeData->isFlagSet(NodeData::Visited) ? "*" : " ") << ", ";
-                }
-                ss << " ]";
-                return ss.str();
-            }
-
             /**
              * This is the visit function during Depth-First-Search,
-             * It adds nodes to the dfsStack if the priority is lower then the one of `nodeData`.
+             * It adds all not visited parents of `node` to the dfsStack.
              */
-            void visit(NodeData& nodeData)
+            void visit(IndexType node)
             {
-                EXECGRAPH_EXECTREE_SOLVER_LOG("visit: '{0}'", nodeData.m_node->getId());
-
-                auto addParentsToStack = [&](auto* socket) {
-                    // Get NodeData of parentNode
-                    auto& parentNode = socket->getParent();
-                    auto itParent    = m_nonConstNodes.find(parentNode.getId());
-                    if(itParent == m_nonConstNodes.end())
-                    {
-                        EXECGRAPH_ASSERT(this->m_constNodes.find(parentNode.getId()) != this->m_constNodes.end(),
-                                         "Parent node with id: '{0}' is not a constant node!",
-                                         parentNode.getId());
-                        return;
-                    }
-                    NodeData* parentNodeData = &itParent->second;
-
-                    if(!parentNodeData->isFlagSet(NodeData::Visited))
-                    {
-                        m_dfrStack.push_back(parentNodeData);  // Add to stack and explore its subgraph
-                    }
-                };
+                EXECGRAPH_EXECTREE_SOLVER_LOG("visit: '{0}'", m_state.m_nodeDatas[node]->m_node->getId());
 
-                // Follow all links
-                auto& inSockets = nodeData.m_node->getInputs();
-                for(auto& socket : inSockets)
+                const IndexType end = m_state.m_parentOffsets[node + 1];
+                for(IndexType k = m_state.m_parentOffsets[node]; k < end; ++k)
                 {
-                    // Try adding the get link to the stack
-                    if(socket->hasGetLink())
+                    const IndexType parent = m_state.m_parents[k];
+                    if(!(m_state.m_flags[parent] & SolverState::Visited))
                     {
-                        addParentsToStack(socket->followGetLink());
-                    }
-                    // Try adding all writing links to the stack
-                    for(auto* outputSocket : socket->getWritingSockets())
-                    {
-                        addParentsToStack(outputSocket);
+                        m_state.m_dfrStack.push_back(parent);  // Add to stack and explore its subgraph
                     }
                 }
 
                 // Mark this node as visited
-                nodeData.setFlag(NodeData::Visited);
+                m_state.m_flags[node] |= SolverState::Visited;
             }
 
-            void assignPrioritiesToChilds(NodeData& nodeData)
+            void assignPrioritiesToParents(IndexType node)
             {
-                auto assignToChild = [&](auto* socket) {
-                    // Get NodeData of parentNode
-                    auto& parentNode = socket->getParent();
-                    auto itParent    = m_nonConstNodes.find(parentNode.getId());
-                    EXECGRAPH_THROW_IF(itParent == m_nonConstNodes.end(),
-                                       "Node with id: '{0}' has not been added to the execution tree!",
-                                       parentNode.getId());
-                    NodeData* parentNodeData = &itParent->second;
-
-                    if(parentNodeData->m_priority <= nodeData.m_priority)
-                    {
-                        parentNodeData->m_priority = nodeData.m_priority + 1;
-                    }
-                };
+                auto& priorities         = m_state.m_priorities;
+                const IndexType priority = priorities[node];
 
-                // Follow all links
-                auto& inSockets = nodeData.m_node->getInputs();
-                for(auto& socket : inSockets)
+                const IndexType end = m_state.m_parentOffsets[node + 1];
+                for(IndexType k = m_state.m_parentOffsets[node]; k < end; ++k)
                 {
-                    // Try adding the get link to the stack
-                    if(socket->hasGetLink())
+                    const IndexType parent = m_state.m_parents[k];
+                    if(priorities[parent] <= priority)
                     {
-                        assignToChild(socket->followGetLink());
-                    }
-                    // Try adding all writing links to the stack
-                    for(auto* outputSocket : socket->getWritingSockets())
-                    {
-                        assignToChild(outputSocket);
+                        priorities[parent] = priority + 1;
                     }
                 }
             }
 
-            bool m_inputReachable     = false;
-            NodeBaseType* m_reachNode = nullptr;
-            NodeDataStorage& m_nonConstNodes;   //!< All node datas of of non-constant nodes.
-            std::vector<NodeData*> m_dfrStack;  //!< Depth-First-Search Stack
+            NodeDataStorage& m_nonConstNodes;  //!< All node datas of of non-constant nodes.
+            SolverState& m_state;              //!< The dense solver state.
         };
 
-        //! Only for directed graphs, does not detect cycles -> endless loop!
-        class ReachNodeCheck
-        {
-        public:
-            // From end to start node
-            bool check(NodeBaseType* endNode, NodeBaseType* startNode)
-            {
-                if(endNode == startNode)
-                {
-                    return true;
-                }
+        std::set<NodeBaseType*> m_nodeClassifications[m_nNodeClasses];  //!< The classification set for each node class.
 
-                m_start   = startNode;
-                m_reached = false;
+        NodeDataMap m_nodes;                   //!< All nodes in the execution tree
+        NodeDataStorage m_nonConstNodes;       //!< All nodes in the execution tree (main storage) except for constant nodes.
+        ConstantNodeDataStorage m_constNodes;  //!< All constant nodes (main storage) which do not need evaluation and are also not part of the execution order.
 
-                std::deque<NodeBaseType*> currentNodes;  // Breath first search
-                currentNodes.push_back(endNode);
+        PrioritySet m_execList;  //!< The global execution order.
 
-                // visit current front node, as long as currentNode list is not empty or
-                // start has not yet been found!
-                while(currentNodes.size() != 0 && m_reached == false)
-                {
-                    visit(currentNodes.front(), currentNodes);
-                    currentNodes.pop_front();
-                }
+        ExecutionPlan m_plan;                                   //!< The compiled global execution order.
+        GroupSpans m_groupSpans;                                //!< All groups with their execution order as a view into `m_plan`.
+        std::unordered_map<NodeId, ExecutionPlan> m_conePlans;  //!< Cached execution plans of input cones (see `evaluate`).
 
-                return m_reached;
-            }
+        std::vector<WriteLinkSlot> m_writeLinks;  //!< All Write-Links of the graph in execution order (see `applyWriteLinks`).
+        bool m_writeLinksApplied = false;         //!< If `m_writeLinks` have been applied since they were compiled.
 
-        private:
-            /**
-             * Breath first search:
-             */
-            void visit(NodeBaseType* node, std::deque<NodeBaseType*>& queu)
-            {
-                // visit all input sockets and their node!
-                auto& inSockets = node->getInputs();
-                for(auto& socket : inSockets)
-                {
-                    if(socket->hasGetLink())
-                    {
-                        auto* outputSocket = socket->followGetLink();
-                        auto& parentNode   = outputSocket->getParent();
-                        // If we reached the start node, return!
-                        if(m_start == &parentNode)
-                        {
-                            m_reached = true;
-                            return;
-                        }
+        //! The encoded value of an output socket in the last `captureValues`.
+        struct SnapshotEntry
+        {
+            NodeId m_nodeId;       //!< The id of the node.
+            SocketIndex m_socket;  //!< The index of the output socket.
+            std::size_t m_offset;  //!< Offset of the encoded value in `m_snapshotValues`.
+            std::size_t m_size;    //!< Size of the encoded value.
+        };
+        std::vector<SnapshotEntry> m_snapshotEntries;      //!< All values of the last capture (for delta snapshots).
+        std::vector<std::uint8_t> m_snapshotValues;        //!< All encoded values of the last capture.
+        std::vector<SnapshotEntry> m_snapshotEntriesNext;  //!< Scratch buffer for the current capture.
+        std::vector<std::uint8_t> m_snapshotValuesNext;    //!< Scratch buffer for the current capture.
 
-                        queu.push_back(&parentNode);
-                    }
-                }
-            }
+        ReachabilityIndex m_reachability;     //!< Reachability index over the global execution plan (see `influences`).
+        bool m_reachabilityUpToDate = false;  //!< If the reachability index is up to date.
 
-            bool m_reached        = false;
-            NodeBaseType* m_start = nullptr;
-        };
+        bool m_lazyEvaluation = false;        //!< If only stale nodes feeding output nodes are computed.
+        bool m_markAllStale   = true;         //!< If all nodes need to be marked stale after the next compile.
+        std::vector<char> m_stale;            //!< Stale flag for each record of the global plan (needs computation).
+        std::vector<char> m_feedsOutput;      //!< Flag for each record of the global plan if it feeds an output node.
+        std::vector<NodeData*> m_staleStack;  //!< Work stack for `markStale`.
 
-        std::set<NodeBaseType*> m_nodeClassifications[m_nNodeClasses];  //!< The classification set for each node class.
+        bool m_executionOrderUpToDate = false;  //!< Dirty flag which denotes that the execution order is not up to date!
 
-        NodeDataMap m_nodes;                   //!< All nodes in the execution tree
-        NodeDataStorage m_nonConstNodes;       //!< All nodes in the execution tree (main storage) except for constant nodes.
-        ConstantNodeDataStorage m_constNodes;  //!< All constant nodes (main storage) which do not need evaluation and are also not part of the execution order.
+        bool m_needsFullSolve    = true;                  //!< If the priorities could not be maintained incrementally (next `setup()` solves fully).
+        bool m_checkReachability = true;                  //!< If the next `setup()` needs to check the reachability of the output nodes.
+        std::unordered_set<NodeId> m_danglingCheckNodes;  //!< Nodes which might have dangling inputs since the last `setup()`.
+        std::vector<NodeData*> m_raiseStack;              //!< Work stack for `raisePriorities` and `lowerPriorities`.
+        std::vector<NodeId> m_lowerNodes;                 //!< Parents of a removed node (see `removeNode`).
+        SolverState m_solverState;                        //!< Dense working state of the full solve (reused over solves).
 
-        GroupNodeMap m_nodeGroups;           //!< The map of nodes in each group.
-        PrioritySet m_execList;              //!< The global execution order.
-        GroupExecutionList m_groupExecList;  //!< The execution order for each group.
+        //! An entry of the search in `wouldCreateCycle`.
+        struct CycleSearchEntry
+        {
+            NodeData* m_node;              //!< The visited node.
+            IndexType m_from;              //!< The entry from which this node was reached.
+            SocketLinkDescription m_link;  //!< The link over which this node was reached.
+        };
 
-        bool m_executionOrderUpToDate = false;  //!< Dirty flag which denotes that the execution order is not up to date!
+        // Scratch buffers for `findCycles` and `wouldCreateCycle` (reused over calls).
+        StronglyConnectedComponents m_scc;                //!< Strongly connected components.
+        std::vector<NodeData*> m_cycleNodes;              //!< All non-constant nodes by dense index.
+        std::vector<IndexType> m_cycleOffsets;            //!< Offsets into `m_cycleSuccessors` for each node.
+        std::vector<IndexType> m_cycleSuccessors;         //!< Child nodes of all nodes (compressed).
+        std::vector<SocketLinkDescription> m_cycleLinks;  //!< The link of each entry in `m_cycleSuccessors`.
+        std::vector<IndexType> m_cycleStart;              //!< Start node of the cycle in each component.
+        std::vector<IndexType> m_cyclePred;               //!< Edge over which each node was reached.
+        std::vector<IndexType> m_cycleQueue;              //!< Breadth-first search queue.
+        std::vector<CycleSearchEntry> m_cycleSearch;      //!< All visited nodes in `wouldCreateCycle`.
+        std::vector<IndexType> m_cycleStack;              //!< Depth-first search stack into `m_cycleSearch`.
 
         LogicNodeDefaultOutputs* m_nodeDefaultOutputPool;  //!< Default Pool with output sockets, to which all not connected input sockets are connected!
 
         NodeId m_nextNodeId = 0;  //!< Next node id currently available.
+
+        ExecutionMode m_executionMode = ExecutionMode::Serial;  //!< The execution mode for `runExecute` and `runReset`.
+        std::unique_ptr<ForkJoinPool> m_threadPool;             //!< The thread pool for the parallel execution modes.
+        Pipeline m_pipeline;                                    //!< The pipeline for `runPipelined`.
+
+        // Declared last: the nodes need to be destroyed (or move-assigned) before their memory.
+        std::unique_ptr<std::pmr::memory_resource> m_nodeMemory;  //!< The memory of the nodes (destroyed after them), `new`/`delete` if `nullptr`.
+        std::unique_ptr<SocketValueArena> m_valueArena;           //!< The arena of the output socket values (destroyed after the nodes), if `ValueLayout::Arena`.
     };
 }  // namespace executionGraph
 
@@ -0,0 +1,333 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "executionGraph/common/Assert.hpp"
+#include "executionGraph/nodes/LogicCommon.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Slot map which stores values of type `T` keyed by a `NodeId`.
+
+        Values live in slots which are never moved, such that pointers and
+        references to elements stay valid until the element is erased.
+        Erased slots are reused for new elements and their generation
+        counter is incremented, such that a `Handle` to an erased element
+        is detected as stale.
+
+        Ids are resolved in O(1) by a dense id-to-slot array. Since ids are
+        mostly handed out sequentially (see `ExecutionTree::generateNodeId`),
+        this array stays small. Far outlying ids (e.g. the id of the default
+        output pool) are stored in a small hash map instead.
+
+        The interface follows `std::unordered_map` (`find`, `emplace`, `erase`
+        and iteration over `std::pair<const NodeId, T>`), iteration order is the slot order.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename T>
+    class NodeSlotMap final
+    {
+    public:
+        using key_type    = NodeId;
+        using mapped_type = T;
+        using value_type  = std::pair<const NodeId, T>;
+        using size_type   = std::size_t;
+
+        //! Handle to an element, which is O(1) to resolve and detects erased elements.
+        struct Handle
+        {
+            IndexType m_slot           = std::numeric_limits<IndexType>::max();  //!< The slot of the element.
+            std::uint32_t m_generation = 0;                                      //!< The generation of the slot.
+        };
+
+    private:
+        static constexpr IndexType noSlot = std::numeric_limits<IndexType>::max();
+
+        struct Slot
+        {
+            std::optional<value_type> m_value;  //!< The element (if occupied).
+            std::uint32_t m_generation = 0;     //!< Generation, incremented on each erase.
+        };
+        using SlotStorage = std::deque<Slot>;  // Growing does not invalidate pointers or references to elements.
+
+        template<bool IsConst>
+        class Iterator
+        {
+            friend class NodeSlotMap;
+            template<bool>
+            friend class Iterator;
+            using Slots = std::conditional_t<IsConst, const SlotStorage, SlotStorage>;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = NodeSlotMap::value_type;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = std::conditional_t<IsConst, const value_type&, value_type&>;
+            using pointer           = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+            Iterator() = default;
+
+            //! Conversion to the const iterator.
+            operator Iterator<true>() const { return {m_slots, m_slot}; }
+
+            reference operator*() const { return *(*m_slots)[m_slot].m_value; }
+            pointer operator->() const { return &**this; }
+
+            Iterator& operator++()
+            {
+                ++m_slot;
+                skipEmpty();
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator it = *this;
+                ++*this;
+                return it;
+            }
+
+            bool operator==(const Iterator& other) const { return m_slot == other.m_slot; }
+            bool operator!=(const Iterator& other) const { return m_slot != other.m_slot; }
+
+        private:
+            Iterator(Slots* slots, IndexType slot)
+                : m_slots(slots), m_slot(slot)
+            {}
+
+            void skipEmpty()
+            {
+                while(m_slot < m_slots->size() && !(*m_slots)[m_slot].m_value)
+                {
+                    ++m_slot;
+                }
+            }
+
+            Slots* m_slots   = nullptr;
+            IndexType m_slot = 0;
+        };
+
+    public:
+        using iterator       = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+    public:
+        NodeSlotMap() = default;
+
+        //! Copying is disabled (pointers to elements are handed out).
+        NodeSlotMap(const NodeSlotMap&) = delete;
+        NodeSlotMap& operator=(const NodeSlotMap&) = delete;
+
+        NodeSlotMap(NodeSlotMap&&) = default;
+        NodeSlotMap& operator=(NodeSlotMap&&) = default;
+
+    public:
+        iterator begin()
+        {
+            iterator it{&m_slots, 0};
+            it.skipEmpty();
+            return it;
+        }
+        iterator end() { return {&m_slots, m_slots.size()}; }
+        const_iterator begin() const
+        {
+            const_iterator it{&m_slots, 0};
+            it.skipEmpty();
+            return it;
+        }
+        const_iterator end() const { return {&m_slots, m_slots.size()}; }
+
+        size_type size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        iterator find(NodeId id)
+        {
+            IndexType slot = findSlot(id);
+            return slot == noSlot ? end() : iterator{&m_slots, slot};
+        }
+        const_iterator find(NodeId id) const
+        {
+            IndexType slot = findSlot(id);
+            return slot == noSlot ? end() : const_iterator{&m_slots, slot};
+        }
+        size_type count(NodeId id) const { return findSlot(id) == noSlot ? 0 : 1; }
+
+        //! Construct an element with id `id` if not yet existing.
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(NodeId id, Args&&... args)
+        {
+            IndexType slot = findSlot(id);
+            if(slot != noSlot)
+            {
+                return {iterator{&m_slots, slot}, false};
+            }
+
+            if(m_freeSlots.empty())
+            {
+                slot = m_slots.size();
+                m_slots.emplace_back();
+            }
+            else
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+
+            m_slots[slot].m_value.emplace(std::piecewise_construct,
+                                          std::forward_as_tuple(id),
+                                          std::forward_as_tuple(std::forward<Args>(args)...));
+            setSlot(id, slot);
+            ++m_size;
+            return {iterator{&m_slots, slot}, true};
+        }
+
+        //! Erase the element with id `id`. Returns the number of erased elements.
+        size_type erase(NodeId id)
+        {
+            IndexType slot = findSlot(id);
+            if(slot == noSlot)
+            {
+                return 0;
+            }
+            eraseSlot(slot);
+            return 1;
+        }
+
+        //! Erase the element at `it`.
+        void erase(const_iterator it)
+        {
+            EXECGRAPH_ASSERT(it.m_slot < m_slots.size() && m_slots[it.m_slot].m_value,
+                             "Erasing invalid iterator!");
+            eraseSlot(it.m_slot);
+        }
+
+        void clear()
+        {
+            m_slots.clear();
+            m_freeSlots.clear();
+            m_denseIds.clear();
+            m_sparseIds.clear();
+            m_size = 0;
+        }
+
+        //! Get the handle to the element with id `id` (invalid if not existing).
+        Handle getHandle(NodeId id) const
+        {
+            IndexType slot = findSlot(id);
+            return slot == noSlot ? Handle{} : Handle{slot, m_slots[slot].m_generation};
+        }
+
+        //! Get the element of the handle `handle`, `nullptr` if the element has been erased.
+        T* get(const Handle& handle)
+        {
+            if(handle.m_slot >= m_slots.size())
+            {
+                return nullptr;
+            }
+            Slot& slot = m_slots[handle.m_slot];
+            return slot.m_value && slot.m_generation == handle.m_generation ? &slot.m_value->second : nullptr;
+        }
+
+        //! Const overload.
+        const T* get(const Handle& handle) const
+        {
+            return const_cast<NodeSlotMap*>(this)->get(handle);
+        }
+
+    private:
+        IndexType findSlot(NodeId id) const
+        {
+            if(id < m_denseIds.size())
+            {
+                return m_denseIds[id];
+            }
+            auto it = m_sparseIds.find(id);
+            return it == m_sparseIds.end() ? noSlot : it->second;
+        }
+
+        void setSlot(NodeId id, IndexType slot)
+        {
+            if(id < m_denseIds.size())
+            {
+                m_denseIds[id] = slot;
+                return;
+            }
+
+            // Only grow the dense ids for ids which are not far outlying.
+            const NodeId maxDenseId = std::max<NodeId>(minDenseIds, 4 * m_slots.size());
+            if(id >= maxDenseId)
+            {
+                m_sparseIds[id] = slot;
+                return;
+            }
+
+            m_denseIds.resize(id + 1, noSlot);
+            m_denseIds[id] = slot;
+
+            // Move all sparse ids which are now covered by the dense ids.
+            for(auto it = m_sparseIds.begin(); it != m_sparseIds.end();)
+            {
+                if(it->first < m_denseIds.size())
+                {
+                    m_denseIds[it->first] = it->second;
+                    it                    = m_sparseIds.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        void eraseSlot(IndexType slot)
+        {
+            Slot& s         = m_slots[slot];
+            const NodeId id = s.m_value->first;
+            if(id < m_denseIds.size())
+            {
+                m_denseIds[id] = noSlot;
+            }
+            else
+            {
+                m_sparseIds.erase(id);
+            }
+
+            s.m_value.reset();
+            ++s.m_generation;
+            m_freeSlots.push_back(slot);
+            --m_size;
+        }
+
+    private:
+        static constexpr NodeId minDenseIds = 1024;  //!< Ids below are always stored dense.
+
+        SlotStorage m_slots;                                //!< All slots (occupied or free).
+        std::vector<IndexType> m_freeSlots;                 //!< All free slots.
+        std::vector<IndexType> m_denseIds;                  //!< Slot for each id in `[0, m_denseIds.size())`.
+        std::unordered_map<NodeId, IndexType> m_sparseIds;  //!< Slot for far outlying ids.
+        size_type m_size = 0;                               //!< Number of elements.
+    };
+}  // namespace executionGraph
@@ -0,0 +1,172 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "executionGraph/common/Assert.hpp"
+#include "executionGraph/nodes/LogicCommon.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Reachability index for a directed acyclic graph with dense node indices `[0, n)`.
+
+        Answers "is node `b` reachable from node `a`" queries.
+        Each node gets an interval label `[low, post]` from a depth-first post-order
+        traversal, where `low` is the minimal post-order number of all reachable nodes.
+        If `b` is reachable from `a` then the interval of `b` is contained in the
+        interval of `a` and `level(a) > level(b)` for any level function which is
+        strictly decreasing along the edges (e.g. the execution priorities).
+        Most negative queries are answered in O(1) by these two tests,
+        the remaining queries run a depth-first search pruned by both tests.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    class ReachabilityIndex
+    {
+    public:
+        using IndexType = executionGraph::IndexType;
+
+    public:
+        ReachabilityIndex() = default;
+
+        //! Build the index for the graph with `levels.size()` nodes.
+        //! The successors of node `i` are `successors[successorOffsets[i], ..., successorOffsets[i+1]-1]`.
+        //! The `levels` need to be strictly decreasing along all edges.
+        void build(std::vector<IndexType> successorOffsets,
+                   std::vector<IndexType> successors,
+                   std::vector<IndexType> levels)
+        {
+            m_successorOffsets = std::move(successorOffsets);
+            m_successors       = std::move(successors);
+            m_levels           = std::move(levels);
+
+            const IndexType nNodes = m_levels.size();
+            EXECGRAPH_ASSERT(m_successorOffsets.size() == nNodes + 1, "Wrong successor offsets size!");
+
+            m_low.assign(nNodes, 0);
+            m_post.assign(nNodes, noIndex);
+            m_visitStamp.assign(nNodes, 0);
+            m_stamp = 0;
+
+            // Iterative depth-first post-order traversal over all nodes.
+            IndexType postCounter = 0;
+            std::vector<std::pair<IndexType, IndexType>> stack;  // (node, next successor offset)
+            for(IndexType root = 0; root < nNodes; ++root)
+            {
+                if(m_post[root] != noIndex)
+                {
+                    continue;
+                }
+
+                m_post[root] = visiting;
+                stack.emplace_back(root, m_successorOffsets[root]);
+                while(!stack.empty())
+                {
+                    auto& [node, next] = stack.back();
+                    if(next < m_successorOffsets[node + 1])
+                    {
+                        IndexType succ = m_successors[next++];
+                        if(m_post[succ] == noIndex)
+                        {
+                            m_post[succ] = visiting;
+                            stack.emplace_back(succ, m_successorOffsets[succ]);
+                        }
+                        continue;
+                    }
+
+                    // All successors finished.
+                    IndexType n  = node;
+                    IndexType lo = postCounter;
+                    for(auto k = m_successorOffsets[n]; k < m_successorOffsets[n + 1]; ++k)
+                    {
+                        lo = std::min(lo, m_low[m_successors[k]]);
+                    }
+                    m_low[n]  = lo;
+                    m_post[n] = postCounter++;
+                    stack.pop_back();
+                }
+            }
+        }
+
+        //! Get the number of nodes in the index.
+        IndexType size() const { return m_levels.size(); }
+
+        //! Check if node `b` is reachable from node `a` (a node reaches itself).
+        bool reaches(IndexType a, IndexType b)
+        {
+            EXECGRAPH_ASSERT(a < size() && b < size(), "Index out of range!");
+            if(a == b)
+            {
+                return true;
+            }
+            if(!mightReach(a, b))
+            {
+                return false;
+            }
+
+            // Pruned depth-first search.
+            ++m_stamp;
+            m_stack.clear();
+            m_stack.emplace_back(a);
+            m_visitStamp[a] = m_stamp;
+            while(!m_stack.empty())
+            {
+                IndexType n = m_stack.back();
+                m_stack.pop_back();
+                for(auto k = m_successorOffsets[n]; k < m_successorOffsets[n + 1]; ++k)
+                {
+                    IndexType succ = m_successors[k];
+                    if(succ == b)
+                    {
+                        return true;
+                    }
+                    if(m_visitStamp[succ] != m_stamp && mightReach(succ, b))
+                    {
+                        m_visitStamp[succ] = m_stamp;
+                        m_stack.emplace_back(succ);
+                    }
+                }
+            }
+            return false;
+        }
+
+    private:
+        //! O(1) necessary condition for `b` being reachable from `a`.
+        bool mightReach(IndexType a, IndexType b) const
+        {
+            return m_levels[a] > m_levels[b] &&
+                   m_low[a] <= m_low[b] && m_post[b] <= m_post[a];
+        }
+
+    private:
+        static constexpr IndexType noIndex  = std::numeric_limits<IndexType>::max();
+        static constexpr IndexType visiting = noIndex - 1;
+
+        std::vector<IndexType> m_successorOffsets;  //!< Offsets into `m_successors` for each node.
+        std::vector<IndexType> m_successors;        //!< Successors of all nodes (compressed).
+        std::vector<IndexType> m_levels;            //!< Level of each node (strictly decreasing along edges).
+        std::vector<IndexType> m_low;               //!< Minimal post-order number of all reachable nodes.
+        std::vector<IndexType> m_post;              //!< Post-order number of each node.
+
+        std::vector<IndexType> m_visitStamp;  //!< Visit stamps for the search (reused over queries).
+        IndexType m_stamp = 0;                //!< The current visit stamp.
+        std::vector<IndexType> m_stack;       //!< Search stack (reused over queries).
+    };
+}  // namespace executionGraph
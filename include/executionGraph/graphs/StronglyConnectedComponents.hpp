@@ -0,0 +1,138 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "executionGraph/common/Assert.hpp"
+#include "executionGraph/nodes/LogicCommon.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Strongly connected components of a directed graph with dense node indices `[0, n)`.
+
+        Iterative version of Tarjan's algorithm, running in O(nodes + edges).
+        All internal buffers are kept over calls to `compute`, such that repeated
+        computations on graphs of similar size do not allocate.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    class StronglyConnectedComponents
+    {
+    public:
+        using IndexType = executionGraph::IndexType;
+
+    public:
+        StronglyConnectedComponents() = default;
+
+        //! Compute the components of the graph with `successorOffsets.size() - 1` nodes.
+        //! The successors of node `i` are `successors[successorOffsets[i], ..., successorOffsets[i+1]-1]`.
+        //! Returns the number of components.
+        IndexType compute(const std::vector<IndexType>& successorOffsets,
+                          const std::vector<IndexType>& successors)
+        {
+            EXECGRAPH_ASSERT(!successorOffsets.empty(), "Wrong successor offsets size!");
+            const IndexType nNodes = successorOffsets.size() - 1;
+
+            m_index.assign(nNodes, noIndex);
+            m_lowLink.assign(nNodes, 0);
+            m_component.assign(nNodes, noIndex);
+            m_stack.clear();
+            m_callStack.clear();
+            m_nComponents = 0;
+
+            IndexType counter = 0;
+            auto push         = [&](IndexType node) {
+                m_index[node] = m_lowLink[node] = counter++;
+                m_stack.emplace_back(node);
+                m_callStack.emplace_back(node, successorOffsets[node]);
+            };
+
+            for(IndexType root = 0; root < nNodes; ++root)
+            {
+                if(m_index[root] != noIndex)
+                {
+                    continue;
+                }
+
+                push(root);
+                while(!m_callStack.empty())
+                {
+                    const IndexType node = m_callStack.back().first;
+                    IndexType& next      = m_callStack.back().second;
+                    if(next < successorOffsets[node + 1])
+                    {
+                        IndexType succ = successors[next++];
+                        if(m_index[succ] == noIndex)
+                        {
+                            push(succ);
+                        }
+                        else if(m_component[succ] == noIndex)
+                        {
+                            // Successor is still on the stack.
+                            m_lowLink[node] = std::min(m_lowLink[node], m_index[succ]);
+                        }
+                        continue;
+                    }
+
+                    // All successors finished.
+                    m_callStack.pop_back();
+                    if(!m_callStack.empty())
+                    {
+                        IndexType& parentLowLink = m_lowLink[m_callStack.back().first];
+                        parentLowLink            = std::min(parentLowLink, m_lowLink[node]);
+                    }
+
+                    if(m_lowLink[node] == m_index[node])
+                    {
+                        // `node` is the root of a component: pop it.
+                        IndexType member;
+                        do
+                        {
+                            member = m_stack.back();
+                            m_stack.pop_back();
+                            m_component[member] = m_nComponents;
+                        } while(member != node);
+                        ++m_nComponents;
+                    }
+                }
+            }
+
+            return m_nComponents;
+        }
+
+        //! Get the number of components of the last computation.
+        IndexType getComponentCount() const { return m_nComponents; }
+
+        //! Get the component of node `node` of the last computation.
+        //! Components are numbered in reverse topological order (successor components first).
+        IndexType getComponent(IndexType node) const { return m_component[node]; }
+
+    private:
+        static constexpr IndexType noIndex = std::numeric_limits<IndexType>::max();
+
+        std::vector<IndexType> m_index;      //!< Discovery index of each node.
+        std::vector<IndexType> m_lowLink;    //!< Minimal discovery index reachable over the current search tree.
+        std::vector<IndexType> m_component;  //!< Component of each node (`noIndex` while on the stack).
+        IndexType m_nComponents = 0;         //!< Number of components.
+
+        std::vector<IndexType> m_stack;                            //!< Nodes of not yet finished components.
+        std::vector<std::pair<IndexType, IndexType>> m_callStack;  //!< Search stack: (node, next successor offset).
+    };
+}  // namespace executionGraph
@@ -65,6 +65,12 @@ namespace executionGraph
     class LogicSocketInput;
     template<typename T, typename TConfig>
     class LogicSocketOutput;
+    template<typename T, typename TConfig>
+    class LogicSocketInputHandle;
+    template<typename T, typename TConfig>
+    class LogicSocketOutputHandle;
+    template<typename TConfig>
+    class LogicSocketValueArena;
 
     template<typename T>
     using SocketPointer = std::unique_ptr<T, void (*)(T*)>;  //! The general socket pointer type.
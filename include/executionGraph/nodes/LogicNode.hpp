@@ -12,29 +12,39 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
 #include <vector>
 #include <rttr/type>
 #include "executionGraph/common/Assert.hpp"
 #include "executionGraph/common/DemangleTypes.hpp"
 #include "executionGraph/nodes/LogicCommon.hpp"
+#include "executionGraph/nodes/LogicSocketValueArena.hpp"
 
 //! Some handy macros to redefine getters to shortcut the following ugly syntax inside a derivation of LogicNode:
 //! Accessing the value in socket Result1 : this->template getValue<typename OutSockets::template Get<Result1>>();
-#define EXECGRAPH_DEFINE_LOGIC_NODE_VALUE_GETTERS(InputEnum, InSocketDeclList, OutputEnum, OutSocketDeclList)           \
-    template<InputEnum S>                                                                                               \
-    inline auto& getInVal() const { return this->template getValue<typename InSocketDeclList::template Get<S>>(); }     \
-                                                                                                                        \
-    template<OutputEnum S>                                                                                              \
-    inline auto& getOutVal() { return this->template getValue<typename OutSocketDeclList::template Get<S>>(); }         \
-                                                                                                                        \
-    template<OutputEnum S>                                                                                              \
-    inline auto& getInVal() const { return this->template getValue<typename OutSocketDeclList::template Get<S>>(); }    \
-                                                                                                                        \
-    template<InputEnum S>                                                                                               \
-    static constexpr executionGraph::SocketIndex getInIdx() { return InSocketDeclList::template Get<S>::Index::value; } \
-    template<OutputEnum S>                                                                                              \
-    static constexpr executionGraph::SocketIndex getOutIdx() { return OutSocketDeclList::template Get<S>::Index::value; }
+#define EXECGRAPH_DEFINE_LOGIC_NODE_VALUE_GETTERS(InputEnum, InSocketDeclList, OutputEnum, OutSocketDeclList)             \
+    template<InputEnum S>                                                                                                 \
+    inline auto& getInVal() const { return this->template getValue<typename InSocketDeclList::template Get<S>>(); }       \
+                                                                                                                          \
+    template<OutputEnum S>                                                                                                \
+    inline auto& getOutVal() { return this->template getValue<typename OutSocketDeclList::template Get<S>>(); }           \
+                                                                                                                          \
+    template<OutputEnum S>                                                                                                \
+    inline auto& getInVal() const { return this->template getValue<typename OutSocketDeclList::template Get<S>>(); }      \
+                                                                                                                          \
+    template<InputEnum S>                                                                                                 \
+    static constexpr executionGraph::SocketIndex getInIdx() { return InSocketDeclList::template Get<S>::Index::value; }   \
+    template<OutputEnum S>                                                                                                \
+    static constexpr executionGraph::SocketIndex getOutIdx() { return OutSocketDeclList::template Get<S>::Index::value; } \
+                                                                                                                          \
+    template<InputEnum S>                                                                                                 \
+    inline auto bindIn() const { return this->template bindInput<typename InSocketDeclList::template Get<S>>(); }         \
+    template<OutputEnum S>                                                                                                \
+    inline auto bindOut() { return this->template bindOutput<typename OutSocketDeclList::template Get<S>>(); }
 
 namespace executionGraph
 {
@@ -86,13 +96,49 @@ namespace executionGraph
     public:
         EXECGRAPH_DEFINE_CONFIG(TConfig);
 
-        using SocketInputListType  = std::vector<SocketInputBasePointer>;
-        using SocketOutputListType = std::vector<SocketOutputBasePointer>;
+        using SocketInputListType  = std::pmr::vector<SocketInputBasePointer>;
+        using SocketOutputListType = std::pmr::vector<SocketOutputBasePointer>;
+
+        template<typename T>
+        using InputHandle = LogicSocketInputHandle<T, Config>;  //!< Typed handle to an input socket.
+        template<typename T>
+        using OutputHandle = LogicSocketOutputHandle<T, Config>;  //!< Typed handle to an output socket.
+
+        using SocketValueArena = LogicSocketValueArena<Config>;  //!< Arena for the output socket values.
+
+        //! Scope in which all nodes constructed on the current thread (with `new`)
+        //! and all their sockets are allocated from the memory resource `resource`.
+        //! If `valueArena` is given, the values of all output sockets are stored in it.
+        //! The resource and the arena need to outlive all these nodes.
+        class MemoryResourceScope
+        {
+        public:
+            explicit MemoryResourceScope(std::pmr::memory_resource* resource,
+                                         SocketValueArena* valueArena = nullptr)
+                : m_previous(std::exchange(t_memoryResource, resource))
+                , m_previousArena(std::exchange(t_valueArena, valueArena)) {}
+            ~MemoryResourceScope()
+            {
+                t_memoryResource = m_previous;
+                t_valueArena     = m_previousArena;
+            }
+
+            MemoryResourceScope(const MemoryResourceScope&) = delete;
+            MemoryResourceScope& operator=(const MemoryResourceScope&) = delete;
+
+        private:
+            std::pmr::memory_resource* m_previous;  //!< The resource of the enclosing scope.
+            SocketValueArena* m_previousArena;      //!< The value arena of the enclosing scope.
+        };
 
     public:
         //! The basic constructor of a node.
         LogicNode(NodeId id)
             : m_id(id)
+            , m_memoryResource(getCurrentMemoryResource())
+            , m_valueArena(t_valueArena)
+            , m_inputs(m_memoryResource)
+            , m_outputs(m_memoryResource)
         {
         }
 
@@ -101,6 +147,42 @@ namespace executionGraph
 
         virtual ~LogicNode() = default;
 
+        //! Allocation of nodes from the memory resource of the current `MemoryResourceScope`.
+        //! The resource is stored in front of the node for the deallocation.
+        //@{
+        static void* operator new(std::size_t size)
+        {
+            return allocateNode(size, alignof(std::max_align_t));
+        }
+
+        static void* operator new(std::size_t size, std::align_val_t alignment)
+        {
+            return allocateNode(size, std::max(static_cast<std::size_t>(alignment), alignof(std::max_align_t)));
+        }
+
+        static void operator delete(void* node)
+        {
+            deallocateNode(node);
+        }
+
+        static void operator delete(void* node, std::align_val_t)
+        {
+            deallocateNode(node);
+        }
+        //@}
+
+        //! Get the memory resource of the current `MemoryResourceScope` (default: `new`/`delete`).
+        static std::pmr::memory_resource* getCurrentMemoryResource()
+        {
+            return t_memoryResource ? t_memoryResource : std::pmr::new_delete_resource();
+        }
+
+        //! Get the memory resource from which the sockets of this node are allocated.
+        std::pmr::memory_resource* getMemoryResource() const { return m_memoryResource; }
+
+        //! Get the arena in which the output socket values of this node are stored (`nullptr` if none).
+        SocketValueArena* getValueArena() const { return m_valueArena; }
+
         //! The reset function.
         virtual void reset() = 0;
 
@@ -196,6 +278,32 @@ namespace executionGraph
                  EXECGRAPH_SFINAE_ENABLE_IF((meta::is<TSocketDeclaration, details::InputSocketDeclaration>::value))>
         const typename TSocketDeclaration::DataType& getValue() const;
 
+        //! Bind a typed handle to the input socket at index `idx`.
+        //! The type `T` is checked once here (throws `BadSocketCastException`),
+        //! the handle then accesses the value without any checks.
+        //! Socket types never change, so nodes bind their handles once after
+        //! adding their sockets and use them in `compute()`.
+        template<typename T>
+        InputHandle<T> bindInput(SocketIndex idx) const;
+        //! Bind a typed handle to the output socket at index `idx` (see `bindInput`).
+        template<typename T>
+        OutputHandle<T> bindOutput(SocketIndex idx);
+
+        //! Bind a typed handle to the input socket of the SocketDeclaration `InputSocketDeclaration`.
+        template<typename TSocketDeclaration,
+                 EXECGRAPH_SFINAE_ENABLE_IF((meta::is<TSocketDeclaration, details::InputSocketDeclaration>::value))>
+        InputHandle<typename TSocketDeclaration::DataType> bindInput() const
+        {
+            return bindInput<typename TSocketDeclaration::DataType>(TSocketDeclaration::Index::value);
+        }
+        //! Bind a typed handle to the output socket of the SocketDeclaration `OutputSocketDeclaration`.
+        template<typename TSocketDeclaration,
+                 EXECGRAPH_SFINAE_ENABLE_IF((meta::is<TSocketDeclaration, details::OutputSocketDeclaration>::value))>
+        OutputHandle<typename TSocketDeclaration::DataType> bindOutput()
+        {
+            return bindOutput<typename TSocketDeclaration::DataType>(TSocketDeclaration::Index::value);
+        }
+
         //! Constructs a Get-Link to get the data from output socket at index `outS`
         //! of node `outN` at the input socket at index `inS` of node
         //! `inN`.
@@ -249,23 +357,58 @@ namespace executionGraph
             SocketIndex id = m_inputs.size();
 
             auto p = SocketPointer<SocketInputBaseType>(
-                new SocketInputType<TData>(id, *this),
-                [](SocketInputBaseType* s) { delete static_cast<SocketInputType<TData>*>(s); });
+                allocateSocket<SocketInputType<TData>>(id, *this),
+                [](SocketInputBaseType* s) { deallocateSocket(static_cast<SocketInputType<TData>*>(s)); });
             m_inputs.push_back(std::move(p));
         }
 
         //! Add an output socket with default value `defaultValue`.
         template<typename TData, typename T>
         void addOSock(T&& defaultValue)
+        {
+            emplaceOSock<TData>(std::forward<T>(defaultValue));
+        }
+
+        //! Add an output socket whose default value is constructed in place with the arguments `args`
+        //! (also for move-only types).
+        template<typename TData, typename... Args>
+        void emplaceOSock(Args&&... args)
         {
             SocketIndex id = m_outputs.size();
 
             auto p = SocketPointer<SocketOutputBaseType>(
-                new SocketOutputType<TData>(std::forward<T>(defaultValue), id, *this),
-                [](SocketOutputBaseType* s) { delete static_cast<SocketOutputType<TData>*>(s); });
+                allocateSocket<SocketOutputType<TData>>(std::in_place, id, *this, std::forward<Args>(args)...),
+                [](SocketOutputBaseType* s) { deallocateSocket(static_cast<SocketOutputType<TData>*>(s)); });
             m_outputs.push_back(std::move(p));
         }
 
+        //! Construct a socket of type `TSocket` in the memory resource of this node.
+        template<typename TSocket, typename... Args>
+        TSocket* allocateSocket(Args&&... args)
+        {
+            std::pmr::polymorphic_allocator<TSocket> allocator(m_memoryResource);
+            TSocket* socket = allocator.allocate(1);
+            try
+            {
+                new(socket) TSocket(std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                allocator.deallocate(socket, 1);
+                throw;
+            }
+            return socket;
+        }
+
+        //! Destroy a socket constructed with `allocateSocket`.
+        template<typename TSocket>
+        static void deallocateSocket(TSocket* socket)
+        {
+            std::pmr::polymorphic_allocator<TSocket> allocator(socket->getParent().getMemoryResource());
+            socket->~TSocket();
+            allocator.deallocate(socket, 1);
+        }
+
         //! Add all input sockets defined in the type list `SocketDeclList`.
         template<typename SocketDeclList,
                  EXECGRAPH_SFINAE_ENABLE_IF((meta::is<SocketDeclList, details::InputSocketDeclarationList>::value))>
@@ -295,12 +438,62 @@ namespace executionGraph
         }
         //@}
 
+    private:
+        //! The header directly in front of each node allocated with `operator new`.
+        struct AllocationHeader
+        {
+            std::pmr::memory_resource* m_resource;  //!< The resource the node is allocated from.
+            std::size_t m_size;                     //!< The size of the node.
+            std::size_t m_alignment;                //!< The alignment of the node.
+        };
+
+        //! The padded size of the header in front of a node with alignment `alignment`,
+        //! such that the node and the header are both aligned.
+        static constexpr std::size_t getAllocationHeaderSize(std::size_t alignment)
+        {
+            alignment = std::max(alignment, alignof(AllocationHeader));
+            return (sizeof(AllocationHeader) + alignment - 1) / alignment * alignment;
+        }
+
+        //! Allocate a node of size `size` with alignment `alignment` from the current memory resource.
+        static void* allocateNode(std::size_t size, std::size_t alignment)
+        {
+            std::pmr::memory_resource* resource = getCurrentMemoryResource();
+            const std::size_t headerSize        = getAllocationHeaderSize(alignment);
+            char* node                          = static_cast<char*>(resource->allocate(size + headerSize, std::max(alignment, alignof(AllocationHeader)))) + headerSize;
+            new(node - sizeof(AllocationHeader)) AllocationHeader{resource, size, alignment};
+            return node;
+        }
+
+        //! Deallocate the node `node` allocated with `allocateNode`.
+        static void deallocateNode(void* node)
+        {
+            if(node == nullptr)
+            {
+                return;
+            }
+            AllocationHeader& header     = *reinterpret_cast<AllocationHeader*>(static_cast<char*>(node) - sizeof(AllocationHeader));
+            const std::size_t headerSize = getAllocationHeaderSize(header.m_alignment);
+            const std::size_t alignment  = std::max(header.m_alignment, alignof(AllocationHeader));
+            header.m_resource->deallocate(static_cast<char*>(node) - headerSize, header.m_size + headerSize, alignment);
+        }
+
+        static thread_local std::pmr::memory_resource* t_memoryResource;  //!< The resource of the current `MemoryResourceScope`.
+        static thread_local SocketValueArena* t_valueArena;               //!< The value arena of the current `MemoryResourceScope`.
+
     protected:
-        const NodeId m_id;               //!< The unique id of the node.
-        SocketInputListType m_inputs;    //!< The input sockets.
-        SocketOutputListType m_outputs;  //!< The output sockets.
+        const NodeId m_id;                            //!< The unique id of the node.
+        std::pmr::memory_resource* m_memoryResource;  //!< The memory resource of the sockets (declared before them).
+        SocketValueArena* m_valueArena;               //!< The arena of the output socket values (`nullptr` if none).
+        SocketInputListType m_inputs;                 //!< The input sockets.
+        SocketOutputListType m_outputs;               //!< The output sockets.
     };
 
+    template<typename TConfig>
+    thread_local std::pmr::memory_resource* LogicNode<TConfig>::t_memoryResource = nullptr;
+    template<typename TConfig>
+    thread_local LogicSocketValueArena<TConfig>* LogicNode<TConfig>::t_valueArena = nullptr;
+
     template<typename TConfig>
     IndexType LogicNode<TConfig>::getConnectedInputCount() const
     {
@@ -385,6 +578,45 @@ namespace executionGraph
         return m_outputs[idx]->template castToType<T>()->getValue();
     }
 
+    template<typename TConfig>
+    template<typename T>
+    typename LogicNode<TConfig>::template InputHandle<T> LogicNode<TConfig>::bindInput(SocketIndex idx) const
+    {
+        EXECGRAPH_THROW_IF(!hasISocket(idx),
+                           "No input socket with index '{0}' on node id: '{1}'!",
+                           idx,
+                           getId());
+        // Always checked (independent of `throwIfBadSocketCast`), since this is done only once.
+        EXECGRAPH_THROW_TYPE_IF(!m_inputs[idx]->template isType<T>(),
+                                BadSocketCastException,
+                                "Binding input socket index '{0}' with type index '{1}' to type "
+                                "'{2}' of node id: '{3}' which is wrong!",
+                                idx,
+                                m_inputs[idx]->getType(),
+                                demangle<T>(),
+                                getId());
+        return InputHandle<T>{*m_inputs[idx]->template castToTypeUnchecked<T>()};
+    }
+
+    template<typename TConfig>
+    template<typename T>
+    typename LogicNode<TConfig>::template OutputHandle<T> LogicNode<TConfig>::bindOutput(SocketIndex idx)
+    {
+        EXECGRAPH_THROW_IF(!hasOSocket(idx),
+                           "No output socket with index '{0}' on node id: '{1}'!",
+                           idx,
+                           getId());
+        EXECGRAPH_THROW_TYPE_IF(!m_outputs[idx]->template isType<T>(),
+                                BadSocketCastException,
+                                "Binding output socket index '{0}' with type index '{1}' to type "
+                                "'{2}' of node id: '{3}' which is wrong!",
+                                idx,
+                                m_outputs[idx]->getType(),
+                                demangle<T>(),
+                                getId());
+        return OutputHandle<T>{*m_outputs[idx]->template castToTypeUnchecked<T>()};
+    }
+
     template<typename TConfig>
     template<typename TSocketDeclaration, EXECGRAPH_SFINAE_ENABLE_IF_IMPL((meta::is<TSocketDeclaration, details::OutputSocketDeclaration>::value))>
     typename TSocketDeclaration::DataType& LogicNode<TConfig>::getValue()
@@ -34,7 +34,7 @@ namespace executionGraph
             // Add a ouput socket with a default-initialized value.
             auto add = [&](auto&& type) {
                 using DataType = std::remove_cv_t<std::remove_reference_t<decltype(type)>>;
-                this->template addOSock<DataType>(DataType{});
+                this->template emplaceOSock<DataType>();
             };
             // Add output socket with default values for all types!
             meta::for_each(SocketTypes{}, add);
@@ -12,13 +12,16 @@
 
 #pragma once
 
-#include <unordered_set>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <meta/meta.hpp>
 
 #include "executionGraph/common/Assert.hpp"
 #include "executionGraph/common/DemangleTypes.hpp"
 #include "executionGraph/common/EnumClassHelper.hpp"
+#include "executionGraph/common/SmallVector.hpp"
 #include "executionGraph/common/TypeDefs.hpp"
 #include "executionGraph/nodes/LogicCommon.hpp"
 
@@ -43,6 +46,46 @@ public:                                                                  \
 
 namespace executionGraph
 {
+    namespace details
+    {
+        //! Jump table which dispatches a visitor on the type index of a socket.
+        //! The table is generated over all types in `SocketTypes` (any length),
+        //! `TypedSocket<T>` is the socket class template the base `Base` is casted to.
+        template<typename SocketTypes, template<typename> class TypedSocket>
+        struct SocketVisitTable;
+
+        template<typename... Types, template<typename> class TypedSocket>
+        struct SocketVisitTable<meta::list<Types...>, TypedSocket>
+        {
+            static_assert(sizeof...(Types) != 0, "Cannot visit empty list!");
+
+            template<typename Base, typename T>
+            using Typed = std::conditional_t<std::is_const<Base>::value, const TypedSocket<T>, TypedSocket<T>>;
+
+            template<typename Base, typename Visitor>
+            using Result = std::common_type_t<decltype(std::declval<Visitor&>()(std::declval<Typed<Base, Types>&>()))...>;
+
+            template<typename Base, typename Visitor>
+            static Result<Base, Visitor> visit(Base& socket, Visitor& visitor)
+            {
+                using Func = Result<Base, Visitor> (*)(Base&, Visitor&);
+                static constexpr Func table[sizeof...(Types)] = {&invoke<Base, Visitor, Types>...};
+
+                EXECGRAPH_ASSERT(socket.getType() < sizeof...(Types),
+                                 "Socket type index '{0}' out of range!",
+                                 socket.getType());
+                return table[socket.getType()](socket, visitor);
+            }
+
+        private:
+            template<typename Base, typename Visitor, typename T>
+            static Result<Base, Visitor> invoke(Base& socket, Visitor& visitor)
+            {
+                return visitor(static_cast<Typed<Base, T>&>(socket));
+            }
+        };
+    }  // namespace details
+
     //! The socket base class for all input/output sockets of a node.
     template<typename TConfig>
     class LogicSocketBase
@@ -132,6 +175,39 @@ namespace executionGraph
             return const_cast<SocketInputType<T>*>(static_cast<LogicSocketInputBase const*>(this)->castToType<T>());
         }
 
+        //! Cast to a logic socket of type `SocketInputType`<T>* without a runtime type check
+        //! (only asserted in debug builds). Use this only if the type has been checked before.
+        template<typename T>
+        auto* castToTypeUnchecked() const
+        {
+            EXECGRAPH_ASSERT(this->template isType<T>(),
+                             "Wrong type '{0}' for socket index '{1}' of node id: '{2}'!",
+                             demangle<T>(),
+                             this->getIndex(),
+                             this->getParent().getId());
+            return static_cast<SocketInputType<T> const*>(this);
+        }
+
+        //! Non-const overload.
+        template<typename T>
+        auto* castToTypeUnchecked()
+        {
+            return const_cast<SocketInputType<T>*>(static_cast<LogicSocketInputBase const*>(this)->castToTypeUnchecked<T>());
+        }
+
+        //! Apply the visitor `visitor` on this socket casted to its type `SocketInputType<T>&`.
+        template<typename Visitor>
+        decltype(auto) applyVisitor(Visitor&& visitor)
+        {
+            return details::SocketVisitTable<SocketTypes, SocketInputType>::visit(*this, visitor);
+        }
+        //! Const overload.
+        template<typename Visitor>
+        decltype(auto) applyVisitor(Visitor&& visitor) const
+        {
+            return details::SocketVisitTable<SocketTypes, SocketInputType>::visit(*this, visitor);
+        }
+
         //! Set the Get-Link to an output socket.
         void setGetLink(SocketOutputBaseType& outputSocket);
 
@@ -151,6 +227,17 @@ namespace executionGraph
         //! Get the connection count of this input socket.
         IndexType getConnectionCount() const { return (hasGetLink() ? 1 : 0) + m_writingParents.size(); }
 
+        //! Get the address of the data pointer of this input socket.
+        //! The address is stable, the data pointer itself changes when Write-Links are executed.
+        void const* const* getDataPointerAddress() const { return &m_data; }
+
+        //! Get the address of the data pointer of this input socket, to which Write-Links write.
+        void const** getDataPointerSlot() { return &m_data; }
+
+        //! Redirect the data pointer of this input socket to `data` (same type!), until the next
+        //! Write-Link writes to it. Used by the execution tree to read buffered values.
+        void setDataPointer(void const* data) { m_data = data; }
+
     protected:
         //! Remove the Get-Link and optionally notify output.
         template<bool notifyOutput = true>
@@ -177,7 +264,7 @@ namespace executionGraph
         //! to this input socket.
         void onRemoveWritter(SocketOutputBaseType& outputSocket)
         {
-            m_writingParents.erase(&outputSocket);
+            m_writingParents.eraseValue(&outputSocket);
 
             // If the data pointer points to this output socket try
             // to reroute to the Get-Link if possible.
@@ -187,9 +274,9 @@ namespace executionGraph
             }
         }
 
-        SocketOutputBaseType* m_getFrom = nullptr;                   //!< The single Get-Link attached to this Socket.
-        void const* m_data              = nullptr;                   //!< The pointer to the actual data of this input node.
-        std::unordered_set<SocketOutputBaseType*> m_writingParents;  //!< All parent output sockets which write to this input.
+        SocketOutputBaseType* m_getFrom = nullptr;               //!< The single Get-Link attached to this Socket.
+        void const* m_data              = nullptr;               //!< The pointer to the actual data of this input node.
+        SmallVector<SocketOutputBaseType*, 2> m_writingParents;  //!< All parent output sockets which write to this input.
     };
 
     //! The input socket base class for all input/output sockets of a node.
@@ -230,7 +317,7 @@ namespace executionGraph
         //! Cast to a logic socket of type `SocketOutputType`<T>*.
         //! The cast fails at runtime if the data type `T` does not match!
         template<typename T>
-        auto* castToType() const noexcept(throwIfBadSocketCast)
+        auto* castToType() const noexcept(!throwIfBadSocketCast)
         {
             EXECGRAPH_THROW_BADSOCKETCAST_IF((this->m_type != meta::find_index<SocketTypes, T>::value),
                                              "Casting socket index '{0}' with type index '{1}' into "
@@ -250,6 +337,39 @@ namespace executionGraph
             return const_cast<SocketOutputType<T>*>(static_cast<LogicSocketOutputBase const*>(this)->castToType<T>());
         }
 
+        //! Cast to a logic socket of type `SocketOutputType`<T>* without a runtime type check
+        //! (only asserted in debug builds). Use this only if the type has been checked before.
+        template<typename T>
+        auto* castToTypeUnchecked() const
+        {
+            EXECGRAPH_ASSERT(this->template isType<T>(),
+                             "Wrong type '{0}' for socket index '{1}' of node id: '{2}'!",
+                             demangle<T>(),
+                             this->getIndex(),
+                             this->getParent().getId());
+            return static_cast<SocketOutputType<T> const*>(this);
+        }
+
+        //! Non-const overload.
+        template<typename T>
+        auto* castToTypeUnchecked()
+        {
+            return const_cast<SocketOutputType<T>*>(static_cast<LogicSocketOutputBase const*>(this)->castToTypeUnchecked<T>());
+        }
+
+        //! Apply the visitor `visitor` on this socket casted to its type `SocketOutputType<T>&`.
+        template<typename Visitor>
+        decltype(auto) applyVisitor(Visitor&& visitor)
+        {
+            return details::SocketVisitTable<SocketTypes, SocketOutputType>::visit(*this, visitor);
+        }
+        //! Const overload.
+        template<typename Visitor>
+        decltype(auto) applyVisitor(Visitor&& visitor) const
+        {
+            return details::SocketVisitTable<SocketTypes, SocketOutputType>::visit(*this, visitor);
+        }
+
         void addWriteLink(SocketInputBaseType& inputSocket);
 
         //! Remove Write-Link to the input socket `inputSocket`.
@@ -266,11 +386,25 @@ namespace executionGraph
                 inputSocket->onRemoveWritter(*this);
             }
             m_writeTo.clear();
+            m_writeLinksBatched = false;
         }
 
         const auto& getGetterSockets() { return m_getterChilds; }
+        //! Get all input sockets to which this socket writes.
+        const auto& getWriteToSockets() const { return m_writeTo; }
         IndexType getConnectionCount() { return m_writeTo.size() + m_getterChilds.size(); }
 
+        //! Get the raw pointer to the data of this output socket.
+        void const* getDataPointer() const { return m_data; }
+
+        //! Set if all Write-Links of this socket are applied by the batched pass of the owning
+        //! tree (see `ExecutionTree::applyWriteLinks`), such that `setValue` does not need to forward
+        //! the data pointer. Only valid if each target input socket has this socket as its only writer.
+        //! Reset on any change of the Write-Links.
+        void setWriteLinksBatched(bool batched) { m_writeLinksBatched = batched; }
+        //! If all Write-Links of this socket are applied by the batched pass of the owning tree.
+        bool isWriteLinksBatched() const { return m_writeLinksBatched; }
+
     protected:
         //! Remove Write-Link to input socket `inputSocket` and optionaly notify the input socket.
         template<bool notifyInput = true>
@@ -281,6 +415,7 @@ namespace executionGraph
             {
                 m_writeTo.erase(it);
             }
+            m_writeLinksBatched = false;
             if(notifyInput)
             {
                 inputSocket.onRemoveWritter(*this);
@@ -289,12 +424,17 @@ namespace executionGraph
         //! Callback when input socket `child` has removed its Get-Link.
         void onRemoveGetter(SocketInputBaseType& inputSocket)
         {
-            m_getterChilds.erase(&inputSocket);
+            m_getterChilds.eraseValue(&inputSocket);
         }
 
         //! Write out value to all connected (Write-Link) input sockets.
+        //! Skipped if the owning tree applies all Write-Links of this socket (the data pointer never changes).
         void executeWriteLinks()
         {
+            if(m_writeLinksBatched)
+            {
+                return;
+            }
             for(auto* inputSocket : this->m_writeTo)
             {
                 inputSocket->m_data = m_data;  // Set data pointer in input socket.
@@ -302,8 +442,9 @@ namespace executionGraph
         }
 
     protected:
-        std::vector<SocketInputBaseType*> m_writeTo;              //!< All Write-Links attached to this Socket.
-        std::unordered_set<SocketInputBaseType*> m_getterChilds;  //!< All child sockets which have a Get-Link to this socket.
+        std::vector<SocketInputBaseType*> m_writeTo;          //!< All Write-Links attached to this Socket.
+        SmallVector<SocketInputBaseType*, 2> m_getterChilds;  //!< All child sockets which have a Get-Link to this socket.
+        bool m_writeLinksBatched = false;                     //!< If the owning tree applies all Write-Links (see `setWriteLinksBatched`).
 
     private:
         void const* const m_data = nullptr;  //!< The raw pointer to the actual data of this output socket.
@@ -358,16 +499,60 @@ namespace executionGraph
     };
 
     //! Data wrapper for the output socket.
+    //! The value is stored inline, or in the value arena `arena` of the node if it has one
+    //! (see `LogicNode::getValueArena`). The owner destroys the value with `destroyValue`.
     template<typename DataType>
     class LogicSocketData
     {
     protected:
-        template<typename T>
-        LogicSocketData(T&& value)
-            : m_data(std::forward<T>(value)) {}
+        template<typename TArena, typename... Args>
+        LogicSocketData(TArena* arena, Args&&... args)
+        {
+            if(arena == nullptr)
+            {
+                new(&m_value) DataType(std::forward<Args>(args)...);
+                return;
+            }
 
-    protected:
-        DataType m_data;
+            m_arenaSlot = arena->template allocate<DataType>();
+            try
+            {
+                m_arenaValue = new(arena->template getStorage<DataType>(m_arenaSlot)) DataType(std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                arena->template deallocate<DataType>(m_arenaSlot);
+                throw;
+            }
+        }
+
+        ~LogicSocketData() {}
+
+        //! Destroy the value (and free its slot in the arena `arena` it was constructed with).
+        template<typename TArena>
+        void destroyValue(TArena* arena)
+        {
+            if(m_arenaValue == nullptr)
+            {
+                m_value.~DataType();
+                return;
+            }
+            m_arenaValue->~DataType();
+            arena->template deallocate<DataType>(m_arenaSlot);
+        }
+
+        //! Get the value.
+        DataType& value() { return m_arenaValue ? *m_arenaValue : m_value; }
+        //! Const overload.
+        const DataType& value() const { return m_arenaValue ? *m_arenaValue : m_value; }
+
+    private:
+        DataType* m_arenaValue  = nullptr;  //!< The value in the arena (`nullptr` if stored inline).
+        std::size_t m_arenaSlot = 0;        //!< The slot of the value in the arena.
+        union
+        {
+            DataType m_value;  //!< The inline value (if not in an arena).
+        };
     };
 
     template<typename TData, typename TConfig>
@@ -384,37 +569,139 @@ namespace executionGraph
         static_assert(!std::is_same<meta::find<SocketTypes, DataType>, meta::list<>>::value,
                       "TData is not in SocketTypes!");
 
-        template<typename T, typename... Args>
-        LogicSocketOutput(T&& initValue, Args&&... args)
-            : LogicSocketData<TData>(std::forward<T>(initValue))
-            , LogicSocketOutputBase<TConfig>(LogicSocketData<TData>::m_data,
+        template<typename T>
+        LogicSocketOutput(T&& initValue, SocketIndex index, NodeBaseType& parent)
+            : LogicSocketOutput(std::in_place, index, parent, std::forward<T>(initValue))
+        {
+        }
+
+        //! Construct the value in place with the arguments `args`.
+        template<typename... Args>
+        LogicSocketOutput(std::in_place_t, SocketIndex index, NodeBaseType& parent, Args&&... args)
+            : LogicSocketData<TData>(parent.getValueArena(), std::forward<Args>(args)...)
+            , LogicSocketOutputBase<TConfig>(DataStorage::value(),
                                              meta::find_index<SocketTypes, DataType>::value,
-                                             std::forward<Args>(args)...)
+                                             index,
+                                             parent)
         {
         }
 
+        ~LogicSocketOutput()
+        {
+            DataStorage::destroyValue(this->getParent().getValueArena());
+        }
+
         //! Copy not allowed (since parent pointer)
         LogicSocketOutput(LogicSocketOutput& other) = delete;
         LogicSocketOutput& operator=(LogicSocketOutput& other) = delete;
 
-        //! Move allowed
-        LogicSocketOutput& operator=(LogicSocketOutput&& other) = default;
-        LogicSocketOutput(LogicSocketOutput&& other)            = default;
+        //! Move not allowed (the value is owned by this socket)
+        LogicSocketOutput& operator=(LogicSocketOutput&& other) = delete;
+        LogicSocketOutput(LogicSocketOutput&& other)            = delete;
 
         //! Set the data value of the socket.
         template<typename T>
         void setValue(T&& value)
         {
             // Set the value
-            DataStorage::m_data = std::forward<T>(value);
+            DataStorage::value() = std::forward<T>(value);
+            // Forward the value to all Write-Links
+            this->executeWriteLinks();
+        }
+
+        //! Swap the data value of the socket with `value` (e.g. a back buffer the node computed into).
+        //! Heavy values are published without any copy.
+        void swapValue(DataType& value)
+        {
+            using std::swap;
+            swap(DataStorage::value(), value);
             // Forward the value to all Write-Links
             this->executeWriteLinks();
         }
 
         //! Get the data value of the socket.
-        const DataType& getValue() const { return DataStorage::m_data; }
+        const DataType& getValue() const { return DataStorage::value(); }
         //! Non-const overload.
-        DataType& getValue() { return DataStorage::m_data; }
+        DataType& getValue() { return DataStorage::value(); }
+    };
+
+    //! Typed handle to an input socket with data type `TData`.
+    //! The type is checked once when the handle is bound (see `LogicNode::bindInput`),
+    //! accessing the value through the handle has no runtime type check.
+    template<typename TData, typename TConfig>
+    class LogicSocketInputHandle final
+    {
+    public:
+        using SocketType = typename TConfig::template SocketInputType<TData>;
+        using DataType   = TData;
+
+        LogicSocketInputHandle() = default;
+        explicit LogicSocketInputHandle(const SocketType& socket)
+            : m_socket(&socket) {}
+
+        //! Check if the handle is bound to a socket.
+        bool isBound() const { return m_socket != nullptr; }
+        //! Get the socket of this handle.
+        const SocketType& getSocket() const { return *m_socket; }
+
+        //! Get the data value of the socket (see `LogicSocketInput::getValue`).
+        const DataType& getValue() const
+        {
+            EXECGRAPH_ASSERT(m_socket, "Handle is not bound!");
+            return m_socket->getValue();
+        }
+        const DataType& operator*() const { return getValue(); }
+        const DataType* operator->() const { return &getValue(); }
+
+    private:
+        const SocketType* m_socket = nullptr;  //!< The bound socket.
+    };
+
+    //! Typed handle to an output socket with data type `TData`.
+    //! The type is checked once when the handle is bound (see `LogicNode::bindOutput`),
+    //! accessing the value through the handle has no runtime type check.
+    template<typename TData, typename TConfig>
+    class LogicSocketOutputHandle final
+    {
+    public:
+        using SocketType = typename TConfig::template SocketOutputType<TData>;
+        using DataType   = TData;
+
+        LogicSocketOutputHandle() = default;
+        explicit LogicSocketOutputHandle(SocketType& socket)
+            : m_socket(&socket) {}
+
+        //! Check if the handle is bound to a socket.
+        bool isBound() const { return m_socket != nullptr; }
+        //! Get the socket of this handle.
+        SocketType& getSocket() const { return *m_socket; }
+
+        //! Get the read/write data value of the socket.
+        DataType& getValue() const
+        {
+            EXECGRAPH_ASSERT(m_socket, "Handle is not bound!");
+            return m_socket->getValue();
+        }
+        DataType& operator*() const { return getValue(); }
+        DataType* operator->() const { return &getValue(); }
+
+        //! Set the data value of the socket (see `LogicSocketOutput::setValue`).
+        template<typename T>
+        void setValue(T&& value) const
+        {
+            EXECGRAPH_ASSERT(m_socket, "Handle is not bound!");
+            m_socket->setValue(std::forward<T>(value));
+        }
+
+        //! Swap the data value of the socket with `value` (see `LogicSocketOutput::swapValue`).
+        void swapValue(DataType& value) const
+        {
+            EXECGRAPH_ASSERT(m_socket, "Handle is not bound!");
+            m_socket->swapValue(value);
+        }
+
+    private:
+        SocketType* m_socket = nullptr;  //!< The bound socket.
     };
 
 }  // namespace executionGraph
@@ -442,7 +729,7 @@ namespace executionGraph
                                 inputSocket.getIndex(),
                                 inputSocket.getParent().getId());
 
-        EXECGRAPH_THROW_TYPE_IF(m_getterChilds.find(&inputSocket) != m_getterChilds.end(),
+        EXECGRAPH_THROW_TYPE_IF(m_getterChilds.contains(&inputSocket),
                                 NodeConnectionException,
                                 "Cannot add Write-Link from output socket index: '{0}' of node id: '{1}' to "
                                 "input socket index '{2} of node id: '{3}' because input "
@@ -455,7 +742,12 @@ namespace executionGraph
         if(std::find(m_writeTo.begin(), m_writeTo.end(), &inputSocket) == m_writeTo.end())
         {
             m_writeTo.push_back(&inputSocket);
-            inputSocket.m_writingParents.emplace(this);
+            inputSocket.m_writingParents.push_back(this);
+            // All writers to this input need to forward their values again.
+            for(auto* outputSocket : inputSocket.m_writingParents)
+            {
+                outputSocket->setWriteLinksBatched(false);
+            }
         }
     }
 
@@ -476,7 +768,7 @@ namespace executionGraph
                                 this->getIndex(),
                                 this->getParent().getId());
 
-        EXECGRAPH_THROW_TYPE_IF(m_writingParents.find(&outputSocket) != m_writingParents.end(),
+        EXECGRAPH_THROW_TYPE_IF(m_writingParents.contains(&outputSocket),
                                 NodeConnectionException,
                                 "Cannot add Get-Link from input socket index: '{0}' of node id: '{1}' to "
                                 "output socket index '{2}' of node id: '{3}' because output already has a "
@@ -486,12 +778,18 @@ namespace executionGraph
                                 outputSocket.getIndex(),
                                 outputSocket.getParent().getId());
 
+        // All writers to this input need to forward their values again.
+        for(auto* writer : m_writingParents)
+        {
+            writer->setWriteLinksBatched(false);
+        }
+
         // Remove Get-Link (if existing)
         removeGetLink();
 
         m_getFrom = &outputSocket;
         m_data    = outputSocket.m_data;  // Set data pointer of this input socket.
-        outputSocket.m_getterChilds.emplace(this);
+        outputSocket.m_getterChilds.push_back(this);
     }
 
 }  // namespace executionGraph
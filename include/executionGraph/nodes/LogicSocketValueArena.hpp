@@ -0,0 +1,193 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <meta/meta.hpp>
+#include "executionGraph/common/Assert.hpp"
+#include "executionGraph/nodes/LogicCommon.hpp"
+
+namespace executionGraph
+{
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Arena which stores the values of output sockets contiguously by socket type.
+
+        For each type `T` in `SocketTypes` there is one `Pool<T>`, which stores
+        all values of type `T` in chunks of `chunkSize` contiguous values.
+        Chunks are never moved, such that pointers to values stay valid
+        until they are deallocated. Deallocated slots are reused.
+
+        Nodes constructed in a `LogicNode::MemoryResourceScope` with an arena
+        store the values of their output sockets here (see `LogicNode::getValueArena`),
+        other output sockets store their values inline.
+        The arena is not thread-safe and needs to outlive these nodes.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    template<typename TConfig>
+    class LogicSocketValueArena final
+    {
+    public:
+        EXECGRAPH_DEFINE_CONFIG(TConfig);
+
+        //! Number of values in each chunk of a pool.
+        static constexpr std::size_t chunkSize = 1024;
+
+        //! All values of type `T` in chunks of `chunkSize` contiguous slots.
+        //! Slot `i` is the value `i % chunkSize` in chunk `i / chunkSize`.
+        template<typename T>
+        class Pool
+        {
+            friend class LogicSocketValueArena;
+
+        public:
+            //! Get the number of used slots (live or free).
+            std::size_t getSlotCount() const { return m_live.size(); }
+            //! Get the number of live values.
+            std::size_t getCount() const { return m_live.size() - m_freeSlots.size(); }
+            //! Get the number of chunks.
+            std::size_t getChunkCount() const { return m_chunks.size(); }
+
+            //! Check if slot `slot` contains a live value.
+            bool isLive(std::size_t slot) const { return m_live[slot]; }
+
+            //! Get the contiguous values of chunk `chunk`, only the live slots may be accessed.
+            T* getChunk(std::size_t chunk) { return reinterpret_cast<T*>(m_chunks[chunk].get()); }
+            //! Const overload.
+            const T* getChunk(std::size_t chunk) const { return reinterpret_cast<const T*>(m_chunks[chunk].get()); }
+
+            //! Get the value in slot `slot` (needs to be live).
+            T& operator[](std::size_t slot)
+            {
+                EXECGRAPH_ASSERT(slot < m_live.size() && m_live[slot], "Slot '{0}' is not live!", slot);
+                return getChunk(slot / chunkSize)[slot % chunkSize];
+            }
+            //! Const overload.
+            const T& operator[](std::size_t slot) const
+            {
+                return const_cast<Pool&>(*this)[slot];
+            }
+
+            //! Apply `f(value)` to all live values in memory order.
+            template<typename F>
+            void forEach(F&& f)
+            {
+                for(std::size_t slot = 0; slot < m_live.size(); ++slot)
+                {
+                    if(m_live[slot])
+                    {
+                        f(getChunk(slot / chunkSize)[slot % chunkSize]);
+                    }
+                }
+            }
+
+        private:
+            //! Allocate uninitialized storage for one value and return its slot.
+            std::size_t allocate()
+            {
+                std::size_t slot;
+                if(m_freeSlots.empty())
+                {
+                    slot = m_live.size();
+                    if(slot == m_chunks.size() * chunkSize)
+                    {
+                        m_chunks.emplace_back(std::make_unique<Storage[]>(chunkSize));
+                    }
+                    m_live.emplace_back(true);
+                }
+                else
+                {
+                    slot = m_freeSlots.back();
+                    m_freeSlots.pop_back();
+                    m_live[slot] = true;
+                }
+                return slot;
+            }
+
+            //! Get the (possibly uninitialized) storage of slot `slot`.
+            T* getStorage(std::size_t slot)
+            {
+                return getChunk(slot / chunkSize) + slot % chunkSize;
+            }
+
+            //! Deallocate the storage of slot `slot` (already destroyed).
+            void deallocate(std::size_t slot)
+            {
+                EXECGRAPH_ASSERT(slot < m_live.size() && m_live[slot], "Deallocating free slot '{0}'!", slot);
+                m_live[slot] = false;
+                m_freeSlots.emplace_back(slot);
+            }
+
+        private:
+            using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+            std::vector<std::unique_ptr<Storage[]>> m_chunks;  //!< All chunks of contiguous values.
+            std::vector<char> m_live;                          //!< Live flag of each used slot.
+            std::vector<std::size_t> m_freeSlots;              //!< All used slots which are free.
+        };
+
+    private:
+        using Pools = meta::apply<meta::quote<std::tuple>, meta::transform<SocketTypes, meta::quote<Pool>>>;
+
+        template<typename T>
+        static constexpr void checkType()
+        {
+            static_assert(!std::is_same<meta::find<SocketTypes, T>, meta::list<>>::value,
+                          "T is not in SocketTypes!");
+        }
+
+    public:
+        LogicSocketValueArena() = default;
+
+        //! Copying and moving is disabled (pointers to values are handed out).
+        LogicSocketValueArena(const LogicSocketValueArena&) = delete;
+        LogicSocketValueArena& operator=(const LogicSocketValueArena&) = delete;
+
+        //! Get the pool of all values of type `T`.
+        template<typename T>
+        Pool<T>& getPool()
+        {
+            checkType<T>();
+            return std::get<Pool<T>>(m_pools);
+        }
+        //! Const overload.
+        template<typename T>
+        const Pool<T>& getPool() const
+        {
+            checkType<T>();
+            return std::get<Pool<T>>(m_pools);
+        }
+
+        //! Allocate uninitialized storage for one value of type `T` and return its slot.
+        template<typename T>
+        std::size_t allocate() { return getPool<T>().allocate(); }
+
+        //! Get the (possibly uninitialized) storage of slot `slot` of type `T`.
+        template<typename T>
+        T* getStorage(std::size_t slot) { return getPool<T>().getStorage(slot); }
+
+        //! Deallocate the storage of slot `slot` of type `T` (already destroyed).
+        template<typename T>
+        void deallocate(std::size_t slot) { getPool<T>().deallocate(slot); }
+
+    private:
+        Pools m_pools;  //!< One pool for each type in `SocketTypes`.
+    };
+}  // namespace executionGraph
@@ -10,6 +10,8 @@
 //  file, You can obtain one at http://mozilla.org/MPL/2.0/.
 // =========================================================================================
 
+#pragma once
+
 #include "executionGraph/nodes/LogicCommon.hpp"
 
 namespace executionGraph
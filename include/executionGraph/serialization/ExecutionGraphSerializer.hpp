@@ -13,6 +13,7 @@
 #pragma once
 
 #include <fstream>
+#include <unordered_map>
 #include "executionGraph/common/Assert.hpp"
 #include "executionGraph/common/BinaryBufferView.hpp"
 #include "executionGraph/common/Exception.hpp"
@@ -272,7 +273,7 @@ namespace executionGraph
             auto nodes = graph.nodes();
             if(nodes)
             {
-                readNodes(execGraph, *nodes);
+                readNodes(execGraph, *nodes, graph.nodeProperties());
             }
 
             auto links = graph.links();
@@ -283,16 +284,52 @@ namespace executionGraph
         }
 
         //! Deserialize all nodes of a graph `graph` into the internal graph.
-        template<typename Nodes>
-        void readNodes(GraphType& execGraph, Nodes& nodes) const
+        //! The node properties `nodeProperties` (classification and groups) are applied if present.
+        template<typename Nodes, typename NodeProperties>
+        void readNodes(GraphType& execGraph, Nodes& nodes, const NodeProperties* nodeProperties) const
         {
+            using NodeClassification = typename GraphType::NodeClassification;
+            using GroupId            = typename GraphType::GroupId;
+
+            // Construct all nodes in the node memory of the graph.
+            typename NodeBaseType::MemoryResourceScope scope(execGraph.getNodeMemoryResource());
+
+            std::unordered_map<uint64_t, const serialization::ExecutionGraphNodeProperties*> properties;
+            if(nodeProperties)
+            {
+                for(auto props : *nodeProperties)
+                {
+                    properties.emplace(props->nodeId(), props);
+                }
+            }
+
             for(auto node : nodes)
             {
                 std::unique_ptr<NodeBaseType> logicNode = m_nodeSerializer.read(*node);
                 if(logicNode)
                 {
                     EXECGRAPH_LOG_TRACE("Adding node with id: '{0}', type: '{0}'", node->id(), node->type()->str());
-                    execGraph.addNode(std::move(logicNode));
+                    auto it = properties.find(node->id());
+                    if(it == properties.end())
+                    {
+                        execGraph.addNode(std::move(logicNode));
+                        continue;
+                    }
+
+                    // Add the node with its classification and all its groups.
+                    auto classification = static_cast<NodeClassification>(it->second->classification());
+                    auto groups         = it->second->groups();
+                    bool hasGroups      = groups && groups->size() != 0;
+                    execGraph.addNode(std::move(logicNode),
+                                      classification,
+                                      hasGroups ? static_cast<GroupId>(groups->Get(0)) : 0);
+                    if(hasGroups && classification != NodeClassification::ConstantNode)
+                    {
+                        for(flatbuffers::uoffset_t i = 1; i < groups->size(); ++i)
+                        {
+                            execGraph.addNodeToGroup(node->id(), static_cast<GroupId>(groups->Get(i)));
+                        }
+                    }
                 }
                 else
                 {
@@ -0,0 +1,178 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "executionGraph/common/Exception.hpp"
+
+namespace executionGraph
+{
+    //! Appends raw bytes to a snapshot buffer.
+    class SocketValueWriter final
+    {
+    public:
+        explicit SocketValueWriter(std::vector<std::uint8_t>& buffer)
+            : m_buffer(buffer) {}
+
+        void write(const void* data, std::size_t size)
+        {
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+        }
+
+        template<typename T>
+        void write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types!");
+            write(&value, sizeof(T));
+        }
+
+    private:
+        std::vector<std::uint8_t>& m_buffer;  //!< The buffer to append to.
+    };
+
+    //! Reads raw bytes from a snapshot buffer.
+    class SocketValueReader final
+    {
+    public:
+        SocketValueReader(const std::uint8_t* data, std::size_t size)
+            : m_data(data), m_size(size) {}
+
+        void read(void* data, std::size_t size)
+        {
+            EXECGRAPH_THROW_IF(size > m_size - m_pos,
+                               "Snapshot is truncated: reading '{0}' bytes at position '{1}' of '{2}'!",
+                               size,
+                               m_pos,
+                               m_size);
+            std::memcpy(data, m_data + m_pos, size);
+            m_pos += size;
+        }
+
+        template<typename T>
+        T read()
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types!");
+            T value;
+            read(&value, sizeof(T));
+            return value;
+        }
+
+        //! Check if all bytes have been read.
+        bool atEnd() const { return m_pos == m_size; }
+
+    private:
+        const std::uint8_t* m_data;  //!< The buffer.
+        std::size_t m_size;          //!< The size of the buffer.
+        std::size_t m_pos = 0;       //!< The current read position.
+    };
+
+    //! Binary encoding of a socket value of type `T` in a `SocketValueSnapshot`.
+    //! Trivially copyable types and `std::string` are supported,
+    //! specialize this for all other types in `Config::SocketTypes`.
+    template<typename T, typename Enable = void>
+    struct SocketValueCodec
+    {
+        static_assert(sizeof(T) == 0, "Specialize SocketValueCodec<T> to snapshot socket values of type T!");
+    };
+
+    template<typename T>
+    struct SocketValueCodec<T, std::enable_if_t<std::is_trivially_copyable<T>::value>>
+    {
+        static void write(SocketValueWriter& writer, const T& value) { writer.write(value); }
+        static void read(SocketValueReader& reader, T& value) { reader.read(&value, sizeof(T)); }
+    };
+
+    template<>
+    struct SocketValueCodec<std::string>
+    {
+        static void write(SocketValueWriter& writer, const std::string& value)
+        {
+            writer.write(static_cast<std::uint64_t>(value.size()));
+            writer.write(value.data(), value.size());
+        }
+        static void read(SocketValueReader& reader, std::string& value)
+        {
+            value.resize(reader.read<std::uint64_t>());
+            reader.read(value.data(), value.size());
+        }
+    };
+
+    /* ---------------------------------------------------------------------------------------*/
+    /*!
+        Compact binary snapshot of output socket values (see `ExecutionTree::captureValues`).
+
+        Layout (native byte order, only restorable on the same platform):
+        - Header: magic `uint32`, version `uint8`, delta flag `uint8`,
+          number of socket types `uint16`, number of nodes `uint64`.
+        - For each node: node id `uint64`, number of values `uint32`.
+        - For each value: socket index `uint32`, type index `uint16`
+          (into `Config::SocketTypes`), the value encoded with `SocketValueCodec`.
+
+        @date Sat Oct 17 2026
+        @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+    */
+    /* ---------------------------------------------------------------------------------------*/
+    class SocketValueSnapshot final
+    {
+    public:
+        static constexpr std::uint32_t magic  = 0x56534745;  //!< "EGSV"
+        static constexpr std::uint8_t version = 1;
+
+        struct Header
+        {
+            std::uint32_t m_magic     = magic;    //!< Magic number.
+            std::uint8_t m_version    = version;  //!< Format version.
+            std::uint8_t m_isDelta    = 0;        //!< If the snapshot only contains changed values.
+            std::uint16_t m_nTypes    = 0;        //!< Number of types in `Config::SocketTypes`.
+            std::uint64_t m_nodeCount = 0;        //!< Number of nodes in the snapshot.
+        };
+
+    public:
+        SocketValueSnapshot() = default;
+        //! Construct from the bytes `data` of a snapshot (e.g. read from a file).
+        explicit SocketValueSnapshot(std::vector<std::uint8_t> data)
+            : m_data(std::move(data)) {}
+
+        //! Get the bytes of the snapshot.
+        const std::vector<std::uint8_t>& getData() const { return m_data; }
+        //! Get the size of the snapshot in bytes.
+        std::size_t getSize() const { return m_data.size(); }
+        bool empty() const { return m_data.empty(); }
+
+        //! Read the header of the snapshot.
+        Header getHeader() const
+        {
+            Header header;
+            EXECGRAPH_THROW_IF(m_data.size() < sizeof(Header), "Snapshot is too small!");
+            std::memcpy(&header, m_data.data(), sizeof(Header));
+            EXECGRAPH_THROW_IF(header.m_magic != magic || header.m_version != version,
+                               "Snapshot has wrong magic number or version '{0}'!",
+                               header.m_version);
+            return header;
+        }
+
+        //! If this snapshot only contains the values changed since the previous capture.
+        bool isDelta() const { return getHeader().m_isDelta != 0; }
+
+        //! Get the buffer for writing.
+        std::vector<std::uint8_t>& getBuffer() { return m_data; }
+
+    private:
+        std::vector<std::uint8_t> m_data;  //!< The encoded snapshot.
+    };
+}  // namespace executionGraph
@@ -0,0 +1,184 @@
+//! ========================================================================================
+//!  ExecutionGraph
+//!  Copyright (C) 2014 by Gabriel Nützi <gnuetzi (at) gmail (døt) com>
+//!
+//!  @date Sat Oct 17 2026
+//!  @author Gabriel Nützi, gnuetzi (at) gmail (døt) com
+//!
+//!  This Source Code Form is subject to the terms of the Mozilla Public
+//!  License, v. 2.0. If a copy of the MPL was not distributed with this
+//!  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//! ========================================================================================
+
+#include "executionGraph/common/CpuTopology.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "executionGraph/common/Exception.hpp"
+
+#if defined(__linux__)
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+namespace executionGraph
+{
+    //! Constructor.
+    CpuTopology::CpuTopology(std::vector<Node> nodes)
+        : m_nodes(std::move(nodes))
+    {
+        EXECGRAPH_THROW_IF(m_nodes.empty(), "CPU topology without nodes!");
+        for(auto& node : m_nodes)
+        {
+            EXECGRAPH_THROW_IF(node.m_cpus.empty(), "Node '{0}' of the CPU topology has no CPUs!", node.m_id);
+        }
+
+        std::sort(m_nodes.begin(), m_nodes.end(), [](auto& a, auto& b) { return a.m_id < b.m_id; });
+        for(auto& node : m_nodes)
+        {
+            std::sort(node.m_cpus.begin(), node.m_cpus.end());
+        }
+    }
+
+    //! Discover the topology by reading `<sysNodeDir>/node<id>/cpulist`.
+    CpuTopology CpuTopology::discover(const std::path& sysNodeDir)
+    {
+        std::vector<Node> nodes;
+
+        std::error_code ec;
+        if(std::filesystem::is_directory(sysNodeDir, ec))
+        {
+            for(auto& entry : std::filesystem::directory_iterator(sysNodeDir, ec))
+            {
+                const std::string name = entry.path().filename().string();
+                if(name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+                   !std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; }))
+                {
+                    continue;
+                }
+
+                std::ifstream file(entry.path() / "cpulist");
+                std::string cpuList;
+                if(!file || !std::getline(file, cpuList))
+                {
+                    continue;
+                }
+
+                auto cpus = parseCpuList(cpuList);
+                if(!cpus.empty())  // Memory-only nodes have no CPUs.
+                {
+                    nodes.push_back(Node{std::stoul(name.substr(4)), std::move(cpus)});
+                }
+            }
+        }
+
+        if(nodes.empty())
+        {
+            // Fallback: a single node with all CPUs.
+            Node node{0, {}};
+            const std::size_t nCpus = std::max(std::thread::hardware_concurrency(), 1u);
+            for(std::size_t cpu = 0; cpu < nCpus; ++cpu)
+            {
+                node.m_cpus.push_back(cpu);
+            }
+            nodes.push_back(std::move(node));
+        }
+
+        return CpuTopology(std::move(nodes));
+    }
+
+    //! Parse a CPU list like "0-3,8,10-11".
+    std::vector<std::size_t> CpuTopology::parseCpuList(const std::string& cpuList)
+    {
+        std::vector<std::size_t> cpus;
+        std::stringstream ss(cpuList);
+        std::string range;
+
+        auto toNumber = [&](const std::string& s) {
+            EXECGRAPH_THROW_IF(s.empty() || !std::all_of(s.begin(), s.end(), [](char c) { return c >= '0' && c <= '9'; }),
+                               "Malformed cpu list '{0}'!",
+                               cpuList);
+            return std::stoul(s);
+        };
+
+        while(std::getline(ss, range, ','))
+        {
+            range.erase(std::remove_if(range.begin(), range.end(), [](unsigned char c) { return std::isspace(c); }), range.end());
+            if(range.empty())
+            {
+                continue;
+            }
+
+            auto dash = range.find('-');
+            if(dash == std::string::npos)
+            {
+                cpus.push_back(toNumber(range));
+            }
+            else
+            {
+                std::size_t first = toNumber(range.substr(0, dash));
+                std::size_t last  = toNumber(range.substr(dash + 1));
+                EXECGRAPH_THROW_IF(first > last, "Malformed cpu list '{0}'!", cpuList);
+                for(std::size_t cpu = first; cpu <= last; ++cpu)
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    //! Get the number of CPUs of all nodes.
+    std::size_t CpuTopology::getCpuCount() const
+    {
+        std::size_t count = 0;
+        for(auto& node : m_nodes)
+        {
+            count += node.m_cpus.size();
+        }
+        return count;
+    }
+
+    //! Get all CPUs grouped by node.
+    std::vector<std::size_t> CpuTopology::getCpusByNode() const
+    {
+        std::vector<std::size_t> cpus;
+        for(auto& node : m_nodes)
+        {
+            cpus.insert(cpus.end(), node.m_cpus.begin(), node.m_cpus.end());
+        }
+        return cpus;
+    }
+
+#if defined(__linux__)
+    bool setCurrentThreadAffinity(const std::vector<std::size_t>& cpus)
+    {
+        if(cpus.empty())
+        {
+            return false;
+        }
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for(auto cpu : cpus)
+        {
+            if(cpu >= CPU_SETSIZE)
+            {
+                return false;
+            }
+            CPU_SET(cpu, &set);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+#else
+    bool setCurrentThreadAffinity(const std::vector<std::size_t>& cpus)
+    {
+        return false;
+    }
+#endif
+}  // namespace executionGraph
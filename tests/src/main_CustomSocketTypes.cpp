@@ -12,6 +12,8 @@
 #include "TestFunctions.hpp"
 
 #include <memory>
+#include <numeric>
+#include <vector>
 #include <meta/meta.hpp>
 #include "executionGraph/graphs/ExecutionTree.hpp"
 #include "executionGraph/nodes/LogicNode.hpp"
@@ -156,6 +158,104 @@ MY_TEST(ExecutionTree_Test, Int_Int)
     EXECGRAPH_THROW_IF(resultNode->getOutVal<CustomDummyNode<Config>::Result1>()->memory[1] != 30, "wrong result");
 }
 
+// A heavy, move-only socket type
+struct Buffer
+{
+    Buffer() = default;
+    Buffer(std::size_t n, double value)
+        : data(n, value) {}
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    Buffer(Buffer&&)                 = default;
+    Buffer& operator=(Buffer&&) = default;
+
+    std::vector<double> data;
+};
+
+using MoveOnlyConfig = GeneralConfig<meta::list<double, Buffer>>;
+
+class BufferProducer : public MoveOnlyConfig::NodeBaseType
+{
+public:
+    using Base = MoveOnlyConfig::NodeBaseType;
+
+    BufferProducer(NodeId id)
+        : Base(id), m_back(4, 0.0)
+    {
+        // Constructed in place, no copy or move of the default value.
+        this->template emplaceOSock<Buffer>(4, 1.0);
+    }
+
+    void reset() override {}
+
+    void compute() override
+    {
+        // Compute into the back buffer and publish it by swapping.
+        ++m_count;
+        std::fill(m_back.data.begin(), m_back.data.end(), m_count);
+        getOSocket<Buffer>(0).swapValue(m_back);
+    }
+
+    Buffer m_back;
+    double m_count = 0;
+};
+
+class BufferConsumer : public MoveOnlyConfig::NodeBaseType
+{
+public:
+    using Base = MoveOnlyConfig::NodeBaseType;
+
+    BufferConsumer(NodeId id)
+        : Base(id)
+    {
+        this->template addISock<Buffer>();
+        this->template addOSock<double>(0.0);
+    }
+
+    void reset() override {}
+
+    void compute() override
+    {
+        const auto& in = getISocket<Buffer>(0).getValue().data;
+        getOSocket<double>(0).setValue(std::accumulate(in.begin(), in.end(), 0.0));
+    }
+};
+
+MY_TEST(ExecutionTree_Test, MoveOnlySwap)
+{
+    auto producer = std::make_unique<BufferProducer>(0u);
+    auto consumer = std::make_unique<BufferConsumer>(1u);
+    auto* p       = producer.get();
+    auto* c       = consumer.get();
+
+    ASSERT_EQ(p->getOSocket<Buffer>(0).getValue().data, std::vector<double>(4, 1.0));
+
+    // Move-only values can be set by moving
+    p->getOSocket<Buffer>(0).setValue(Buffer(2, 3.0));
+    ASSERT_EQ(p->getOSocket<Buffer>(0).getValue().data, std::vector<double>(2, 3.0));
+
+    c->setGetLink(*p, 0, 0);
+
+    ExecutionTree<MoveOnlyConfig> execTree;
+    execTree.getDefaultOuputPool().setDefaultValue(Buffer(1, 0.0));
+    execTree.addNode(std::move(producer));
+    execTree.addNode(std::move(consumer));
+    execTree.setNodeClass(0, ExecutionTree<MoveOnlyConfig>::NodeClassification::InputNode);
+    execTree.setNodeClass(1, ExecutionTree<MoveOnlyConfig>::NodeClassification::OutputNode);
+    execTree.setup();
+
+    execTree.runExecute(0);
+    ASSERT_EQ(c->getOSocket<double>(0).getValue(), 4.0);
+    // The previous front buffer is now the back buffer.
+    ASSERT_EQ(p->m_back.data, std::vector<double>(2, 3.0));
+
+    execTree.runExecute(0);
+    ASSERT_EQ(c->getOSocket<double>(0).getValue(), 4.0);  // size 2 buffer filled with 2
+    execTree.runExecute(0);
+    ASSERT_EQ(c->getOSocket<double>(0).getValue(), 12.0);
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
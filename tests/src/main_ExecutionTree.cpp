@@ -131,6 +131,842 @@ MY_TEST(ExecutionTree_Test, IntBig)
     }
 }
 
+MY_TEST(ExecutionTree_Test, IntBigParallel)
+{
+    using IntNode      = DummyNode<Config>;
+    using TreeType     = ExecutionTree<Config>;
+    std::size_t nNodes = 500;
+
+    for(auto mode : {TreeType::ExecutionMode::ParallelLevels, TreeType::ExecutionMode::DataFlow})
+    {
+        for(int seed = 0; seed < 5; ++seed)
+        {
+            auto serialTree   = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+            auto parallelTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+            parallelTree->setExecutionMode(mode, 4);
+
+            serialTree->runExecute();
+            parallelTree->runExecute();
+            parallelTree->runExecute(0);
+
+            const TreeType& s = *serialTree;
+            const TreeType& p = *parallelTree;
+            for(NodeId id = 0; id < nNodes; ++id)
+            {
+                auto* serialNode   = s.getNode(id);
+                auto* parallelNode = p.getNode(id);
+                ASSERT_EQ(serialNode->template getOutVal<int>(0),
+                          parallelNode->template getOutVal<int>(0))
+                    << "wrong result for node id: " << id;
+            }
+        }
+    }
+}
+
+MY_TEST(ExecutionTree_Test, IncrementalSetup)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+    int nNodes     = 300;
+    int nEdits     = 100;
+
+    for(int seed = 0; seed < 5; ++seed)
+    {
+        DEFINE_RANDOM_GENERATOR_FUNC(seed);
+
+        auto incTree  = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+        auto fullTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+
+        // All links go from lower to higher rank (initially the id) -> no cycles.
+        std::vector<double> rank(nNodes);
+        std::iota(rank.begin(), rank.end(), 0.0);
+
+        for(int e = 0; e < nEdits; ++e)
+        {
+            // Insert a new node in front of node `c` which gets data from node `a` and `b`.
+            NodeId c = 1 + NodeId(rand() * (rank.size() - 1));
+            std::vector<NodeId> lower;
+            for(NodeId id = 0; id < rank.size(); ++id)
+            {
+                if(rank[id] < rank[c])
+                {
+                    lower.emplace_back(id);
+                }
+            }
+            NodeId a = lower[NodeId(rand() * lower.size())];
+            NodeId b = lower[NodeId(rand() * lower.size())];
+            NodeId n = rank.size();
+            rank.emplace_back(0.5 * (std::max(rank[a], rank[b]) + rank[c]));
+
+            for(auto* tree : {incTree.get(), fullTree.get()})
+            {
+                tree->addNode(std::make_unique<IntNode>(n));
+                tree->setGetLink(a, 0, n, 0);
+                tree->setGetLink(b, 0, n, 1);
+                tree->setGetLink(n, 0, c, 0);
+                if(e % 3 == 0)
+                {
+                    tree->removeGetLink(c, 0);  // The cone above `n` might get lower priorities.
+                }
+            }
+
+            if(e % 10 == 0)
+            {
+                incTree->setup(true, true);
+                fullTree->getNode(0);  // Forces a full solve.
+                fullTree->setup(true, true);
+            }
+        }
+
+        incTree->setup(true, true);
+        fullTree->getNode(0);  // Forces a full solve.
+        fullTree->setup(true, true);
+
+        incTree->runExecute();
+        fullTree->runExecute();
+
+        const TreeType& inc  = *incTree;
+        const TreeType& full = *fullTree;
+        for(NodeId id = 0; id < rank.size(); ++id)
+        {
+            ASSERT_EQ(inc.getNode(id)->template getOutVal<int>(0),
+                      full.getNode(id)->template getOutVal<int>(0))
+                << "wrong result for node id: " << id;
+            ASSERT_EQ(inc.getNodes().first.find(id)->second.m_priority, full.getNodes().first.find(id)->second.m_priority)
+                << "wrong priority for node id: " << id;
+        }
+    }
+}
+
+MY_TEST(ExecutionTree_Test, IncrementalSetupRemoval)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+
+    TreeType execTree;
+    execTree.addNode(std::make_unique<IntNode>(0), TreeType::NodeClassification::InputNode);
+    execTree.addNode(std::make_unique<IntNode>(1));
+    execTree.addNode(std::make_unique<IntNode>(2));
+    execTree.addNode(std::make_unique<IntNode>(3), TreeType::NodeClassification::OutputNode);
+    execTree.setGetLink(0, 0, 1, 0);
+    execTree.setGetLink(1, 0, 2, 0);
+    execTree.setGetLink(2, 0, 3, 0);
+    execTree.setGetLink(0, 0, 3, 1);
+    execTree.setup();
+
+    const TreeType& tree = execTree;
+    auto priority        = [&](NodeId id) { return tree.getNodes().first.find(id)->second.m_priority; };
+    ASSERT_EQ(priority(0), 3);
+
+    // Removing links lowers the priorities of the upstream cone.
+    execTree.removeGetLink(2, 0);
+    execTree.setup();
+    ASSERT_EQ(priority(1), 0);
+    ASSERT_EQ(priority(2), 1);
+    ASSERT_EQ(priority(0), 1);
+
+    // Removing nodes lowers the priorities of their parents.
+    execTree.setGetLink(0, 0, 2, 0);
+    execTree.setup();
+    ASSERT_EQ(priority(0), 2);
+    execTree.removeNode(2);
+    execTree.setup();
+    ASSERT_EQ(priority(0), 1);
+}
+
+MY_TEST(ExecutionTree_Test, IncrementalSetupCycle)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+
+    TreeType execTree;
+    execTree.addNode(std::make_unique<IntNode>(0), TreeType::NodeClassification::InputNode);
+    execTree.addNode(std::make_unique<IntNode>(1));
+    execTree.addNode(std::make_unique<IntNode>(2), TreeType::NodeClassification::OutputNode);
+    execTree.setGetLink(0, 0, 1, 0);
+    execTree.setGetLink(1, 0, 2, 0);
+    execTree.setup();
+
+    execTree.addWriteLink(2, 0, 0, 1);  // Cycle.
+    ASSERT_THROW(execTree.setup(), ExecutionGraphCycleException);
+
+    execTree.removeWriteLink(2, 0, 0, 1);
+    ASSERT_NO_THROW(execTree.setup());
+}
+
+MY_TEST(ExecutionTree_Test, LazyEvaluation)
+{
+    using IntNode      = DummyNode<Config>;
+    using TreeType     = ExecutionTree<Config>;
+    std::size_t nNodes = 300;
+
+    for(int seed = 0; seed < 5; ++seed)
+    {
+        auto lazyTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+        auto fullTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+        lazyTree->setLazyEvaluation(true);
+
+        const TreeType& lazy = *lazyTree;
+        const TreeType& full = *fullTree;
+        auto getResults      = [nNodes](const TreeType& tree) {
+            std::vector<int> results;
+            for(NodeId id = 0; id < nNodes; ++id)
+            {
+                results.emplace_back(tree.getNode(id)->template getOutVal<int>(0));
+            }
+            return results;
+        };
+
+        lazyTree->runExecute();
+        fullTree->runExecute();
+        auto results = getResults(lazy);
+        ASSERT_EQ(results, getResults(full)) << "wrong results";
+
+        // Change the input of node 0 (connected to the default output pool).
+        lazyTree->getDefaultOuputPool().setDefaultValue<int>(3);
+        fullTree->getDefaultOuputPool().setDefaultValue<int>(3);
+
+        // Nothing marked dirty: nothing gets recomputed.
+        lazyTree->runExecute();
+        ASSERT_EQ(getResults(lazy), results) << "lazy evaluation recomputed clean nodes";
+
+        lazyTree->markDirty(0);
+        lazyTree->runExecute();
+        fullTree->runExecute();
+        ASSERT_EQ(getResults(lazy), getResults(full)) << "wrong results after marking dirty";
+    }
+
+    // Groups: A(0) --> B(1), B alone in group 5, A alone in group 6.
+    TreeType execTree;
+    execTree.addNode(std::make_unique<IntNode>(0), TreeType::NodeClassification::InputNode);
+    execTree.addNode(std::make_unique<IntNode>(1), TreeType::NodeClassification::OutputNode);
+    execTree.setGetLink(0, 0, 1, 0);
+    execTree.addNodeToGroup(1, 5);
+    execTree.addNodeToGroup(0, 6);
+    execTree.setup();
+    execTree.setLazyEvaluation(true);
+
+    const TreeType& tree = execTree;
+    auto getResult       = [&tree](NodeId id) { return tree.getNode(id)->template getOSocket<int>(0).getValue(); };
+
+    // A group run must not leave its member clean while its parent outside the group is stale.
+    execTree.runExecute();
+    execTree.getDefaultOuputPool().setDefaultValue<int>(10);
+    execTree.markDirty(0);
+    execTree.runExecute(5);
+    execTree.runExecute();
+    ASSERT_EQ(getResult(0), 20) << "wrong result";
+    ASSERT_EQ(getResult(1), 30) << "wrong result after group execution";
+
+    // Resetting a group marks all nodes downstream stale.
+    execTree.getDefaultOuputPool().setDefaultValue<int>(1);
+    execTree.runReset(6);
+    execTree.runExecute();
+    ASSERT_EQ(getResult(0), 2) << "wrong result";
+    ASSERT_EQ(getResult(1), 3) << "wrong result after group reset";
+}
+
+MY_TEST(ExecutionTree_Test, EvaluateSingleOutput)
+{
+    using IntNode      = DummyNode<Config>;
+    using TreeType     = ExecutionTree<Config>;
+    std::size_t nNodes = 300;
+
+    for(int seed = 0; seed < 5; ++seed)
+    {
+        auto coneTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+        auto fullTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+        fullTree->runExecute();
+
+        const TreeType& cone = *coneTree;
+        const TreeType& full = *fullTree;
+
+        std::vector<NodeId> outputs;
+        for(NodeId id = 0; id < nNodes; ++id)
+        {
+            if(cone.getNode(id)->getConnectedOutputCount() == 0)
+            {
+                outputs.emplace_back(id);
+            }
+        }
+        ASSERT_GT(outputs.size(), 1) << "Test needs more than one output!";
+
+        coneTree->evaluate(outputs.front());
+        coneTree->evaluate(outputs.front());  // Cached cone.
+        ASSERT_EQ(cone.getNode(outputs.front())->template getOutVal<int>(0),
+                  full.getNode(outputs.front())->template getOutVal<int>(0))
+            << "wrong result";
+
+        for(auto it = outputs.begin() + 1; it != outputs.end(); ++it)
+        {
+            ASSERT_EQ(cone.getNode(*it)->template getOutVal<int>(0), 0)
+                << "output node id: " << *it << " outside of the cone has been computed";
+        }
+    }
+}
+
+MY_TEST(ExecutionTree_Test, Influences)
+{
+    using IntNode      = DummyNode<Config>;
+    using TreeType     = ExecutionTree<Config>;
+    std::size_t nNodes = 200;
+
+    for(int seed = 0; seed < 3; ++seed)
+    {
+        auto execTree = createRandomTree<TreeType, IntNode>(nNodes, seed, false, false);
+
+        // Brute force: all ancestors of each node (by following Get-Links upstream).
+        std::vector<std::unordered_set<NodeId>> ancestors(nNodes);
+        for(NodeId id = 0; id < nNodes; ++id)
+        {
+            std::vector<NodeId> stack{id};
+            while(!stack.empty())
+            {
+                auto* node = execTree->getNode(stack.back());
+                stack.pop_back();
+                for(auto& socket : node->getInputs())
+                {
+                    if(socket->hasGetLink())
+                    {
+                        NodeId parentId = socket->followGetLink()->getParent().getId();
+                        if(parentId < nNodes && ancestors[id].emplace(parentId).second)
+                        {
+                            stack.emplace_back(parentId);
+                        }
+                    }
+                }
+            }
+        }
+        execTree->setup();
+
+        for(NodeId a = 0; a < nNodes; ++a)
+        {
+            for(NodeId b = 0; b < nNodes; ++b)
+            {
+                bool expected = (a == b) || ancestors[b].count(a);
+                ASSERT_EQ(execTree->influences(a, b), expected) << "wrong reachability: " << a << " -> " << b;
+            }
+        }
+    }
+}
+
+MY_TEST(ExecutionTree_Test, FindCycles)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+
+    TreeType execTree;
+    execTree.addNode(std::make_unique<IntNode>(0), TreeType::NodeClassification::InputNode);
+    for(NodeId id = 1; id < 6; ++id)
+    {
+        execTree.addNode(std::make_unique<IntNode>(id));
+    }
+    execTree.addNode(std::make_unique<IntNode>(6), TreeType::NodeClassification::OutputNode);
+
+    execTree.setGetLink(0, 0, 1, 0);
+    execTree.setGetLink(1, 0, 2, 0);
+    execTree.setGetLink(2, 0, 6, 0);
+    execTree.addWriteLink(2, 0, 1, 1);  // Cycle: 1 -> 2 -> 1.
+    execTree.setGetLink(3, 0, 4, 0);
+    execTree.setGetLink(4, 0, 5, 0);
+    execTree.setGetLink(5, 0, 3, 0);  // Cycle: 3 -> 4 -> 5 -> 3.
+
+    ASSERT_THROW(execTree.setup(), ExecutionGraphCycleException);
+
+    std::vector<CycleDescription> cycles;
+    ASSERT_EQ(execTree.findCycles(cycles), 2) << "not all cycles found";
+    ASSERT_EQ(cycles.size(), 2);
+
+    std::vector<std::size_t> lengths;
+    for(auto& cycle : cycles)
+    {
+        ASSERT_FALSE(cycle.empty());
+        for(std::size_t i = 0; i < cycle.size(); ++i)
+        {
+            ASSERT_EQ(cycle[i].m_inNodeId, cycle[(i + 1) % cycle.size()].m_outNodeId) << "cycle path not closed";
+        }
+        lengths.emplace_back(cycle.size());
+    }
+    std::sort(lengths.begin(), lengths.end());
+    ASSERT_EQ(lengths, (std::vector<std::size_t>{2, 3}));
+
+    // Remove both cycles.
+    execTree.removeWriteLink(2, 0, 1, 1);
+    execTree.removeGetLink(3, 0);
+    cycles.clear();
+    ASSERT_EQ(execTree.findCycles(cycles), 0);
+    ASSERT_NO_THROW(execTree.setup());
+
+    // Online check of new links (with up to date priorities and after an invalidation).
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        CycleDescription cycle;
+        ASSERT_TRUE(execTree.wouldCreateCycle({6, 0, 0, 1, true}, &cycle));
+        ASSERT_EQ(cycle.size(), 4) << "wrong cycle: 6 -> 0 -> 1 -> 2 -> 6";
+        ASSERT_EQ(cycle.front().m_outNodeId, 6);
+        ASSERT_EQ(cycle.back().m_inNodeId, 6);
+
+        ASSERT_TRUE(execTree.wouldCreateCycle({1, 0, 1, 1, false}, &cycle));
+        ASSERT_EQ(cycle.size(), 1);
+
+        ASSERT_FALSE(execTree.wouldCreateCycle({0, 0, 2, 1, true}));
+        ASSERT_FALSE(execTree.wouldCreateCycle({5, 0, 0, 1, false}));
+
+        execTree.getNode(0);  // Invalidates the priorities.
+    }
+}
+
+MY_TEST(ExecutionTree_Test, Pipelined)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+
+    //! Input node producing the frame number.
+    struct FrameNode : IntNode
+    {
+        using IntNode::IntNode;
+        void compute() override { getOutVal<Result1>() = m_frame++; }
+        int m_frame = 0;
+    };
+
+    //! Node adding its inputs with wrap-around (the sums grow exponentially along the chain).
+    struct SumNode : IntNode
+    {
+        using IntNode::IntNode;
+        void compute() override
+        {
+            getOutVal<Result1>() = static_cast<int>(static_cast<unsigned int>(getInVal<Value1>()) +
+                                                    static_cast<unsigned int>(getInVal<Value2>()));
+        }
+    };
+
+    const int nNodes  = 200;
+    const int nFrames = 50;
+
+    // Random graph where each node depends on up to two earlier nodes.
+    auto createTree = [&](int seed) {
+        auto execTree = std::make_unique<TreeType>();
+        std::mt19937 gen(seed);
+        execTree->addNode(std::make_unique<FrameNode>(0), TreeType::NodeClassification::InputNode);
+        for(NodeId id = 1; id < nNodes; ++id)
+        {
+            execTree->addNode(std::make_unique<SumNode>(id),
+                              id + 1 == nNodes ? TreeType::NodeClassification::OutputNode
+                                               : TreeType::NodeClassification::NormalNode);
+            execTree->setGetLink(std::max<int>(0, id - 1 - gen() % 3), 0, id, 0);
+            execTree->setGetLink(gen() % id, 0, id, 1);
+        }
+        execTree->setup();
+        return execTree;
+    };
+
+    for(int seed = 0; seed < 3; ++seed)
+    {
+        auto serialTree        = createTree(seed);
+        const TreeType& serial = *serialTree;
+        std::vector<int> expected;
+        for(int frame = 0; frame <= nFrames; ++frame)
+        {
+            serialTree->runExecute();
+            expected.emplace_back(serial.getNode(nNodes - 1)->template getOutVal<int>(0));
+        }
+
+        for(std::size_t nBuffers : {2, 3})
+        {
+            auto pipelinedTree = createTree(seed);
+            pipelinedTree->setPipeline(4, nBuffers);
+
+            std::vector<int> results;
+            const TreeType& tree = *pipelinedTree;
+            pipelinedTree->runPipelined(nFrames, [&](std::size_t frame) {
+                ASSERT_EQ(frame, results.size()) << "frames out of order";
+                results.emplace_back(tree.getNode(nNodes - 1)->template getOutVal<int>(0));
+            });
+
+            // The serial execution works afterwards.
+            pipelinedTree->runExecute();
+            results.emplace_back(tree.getNode(nNodes - 1)->template getOutVal<int>(0));
+            ASSERT_EQ(results, expected) << "wrong pipelined results (buffers: " << nBuffers << ")";
+        }
+    }
+}
+
+//! Over-aligned node.
+struct alignas(64) AlignedNode : DummyNode<Config>
+{
+    using DummyNode<Config>::DummyNode;
+};
+
+MY_TEST(ExecutionTree_Test, NodeMemory)
+{
+    using IntNode      = DummyNode<Config>;
+    using TreeType     = ExecutionTree<Config>;
+    std::size_t nNodes = 500;
+
+    //! Arena counting all allocations.
+    struct CountingArena : std::pmr::memory_resource
+    {
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++m_allocations;
+            return m_arena.allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            ++m_deallocations;
+            m_arena.deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::pmr::monotonic_buffer_resource m_arena;
+        std::size_t m_allocations   = 0;
+        std::size_t m_deallocations = 0;
+    };
+
+    CountingArena arena;
+    std::unique_ptr<TreeType> arenaTree;
+    {
+        IntNode::MemoryResourceScope scope(&arena);
+        arenaTree = createRandomTree<TreeType, IntNode>(nNodes, 1, false, false);
+    }
+    // Each node: the node, its socket lists and its 3 sockets.
+    ASSERT_GE(arena.m_allocations, 6 * nNodes) << "nodes not allocated in the arena";
+
+    auto heapTree = createRandomTree<TreeType, IntNode>(nNodes, 1, false, false);
+    arenaTree->runExecute();
+    heapTree->runExecute();
+
+    const TreeType& arenaResults = *arenaTree;
+    const TreeType& heapResults  = *heapTree;
+    for(NodeId id = 0; id < nNodes; ++id)
+    {
+        ASSERT_EQ(arenaResults.getNode(id)->template getOutVal<int>(0),
+                  heapResults.getNode(id)->template getOutVal<int>(0))
+            << "wrong result of node: " << id;
+    }
+
+    arenaTree->removeNode(0);
+    arenaTree = nullptr;
+    ASSERT_EQ(arena.m_allocations, arena.m_deallocations) << "not all nodes deallocated";
+
+    // Tree owning its node memory.
+    TreeType poolTree(std::make_unique<std::pmr::unsynchronized_pool_resource>());
+    auto node = poolTree.createNode<IntNode>(0);
+    ASSERT_EQ(node->getMemoryResource(), poolTree.getNodeMemoryResource());
+    poolTree.addNode(std::move(node), TreeType::NodeClassification::OutputNode);
+    poolTree.addNode(poolTree.createNode<IntNode>(1));
+    ASSERT_EQ(poolTree.removeNode(1), nullptr) << "node in the tree memory handed out";
+
+    // Move assignment destroys the nodes before their memory.
+    TreeType arenaPoolTree(std::make_unique<std::pmr::unsynchronized_pool_resource>(), TreeType::ValueLayout::Arena);
+    arenaPoolTree.addNode(arenaPoolTree.createNode<IntNode>(0), TreeType::NodeClassification::OutputNode);
+    poolTree = std::move(arenaPoolTree);
+    poolTree.setup();
+    poolTree.runExecute();
+    poolTree = TreeType{};
+
+    // Over-aligned nodes.
+    {
+        IntNode::MemoryResourceScope scope(&arena);
+        auto alignedNode = std::make_unique<AlignedNode>(0);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(alignedNode.get()) % alignof(AlignedNode), 0) << "node not aligned";
+    }
+    ASSERT_EQ(arena.m_allocations, arena.m_deallocations) << "not all nodes deallocated";
+}
+
+MY_TEST(ExecutionTree_Test, NodeHandles)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+
+    TreeType execTree;
+    const TreeType& constTree = execTree;
+    const NodeId farId        = NodeId(1) << 40;
+
+    for(NodeId id = 0; id < 10; ++id)
+    {
+        execTree.addNode(std::make_unique<IntNode>(id));
+    }
+    execTree.addNode(std::make_unique<IntNode>(farId));
+    ASSERT_EQ(execTree.getNodes().first.size(), 11) << "Wrong node count";
+
+    auto handle    = constTree.getNodeHandle(3);
+    auto farHandle = constTree.getNodeHandle(farId);
+    ASSERT_EQ(constTree.getNode(handle)->getId(), 3);
+    ASSERT_EQ(constTree.getNode(farHandle)->getId(), farId);
+    ASSERT_EQ(constTree.getNode(constTree.getNodeHandle(10)), nullptr) << "Handle to missing node";
+
+    // Removed nodes invalidate the handle, also if its slot is reused.
+    execTree.removeNode(3);
+    ASSERT_EQ(constTree.getNode(handle), nullptr) << "Stale handle resolved!";
+    ASSERT_EQ(constTree.getNode(3), nullptr);
+    execTree.addNode(std::make_unique<IntNode>(3));
+    ASSERT_EQ(constTree.getNode(handle), nullptr) << "Stale handle resolved!";
+    ASSERT_EQ(constTree.getNode(constTree.getNodeHandle(3))->getId(), 3);
+    ASSERT_EQ(constTree.getNode(farHandle)->getId(), farId);
+
+    // Iteration visits each node exactly once.
+    std::set<NodeId> ids;
+    for(auto& keyValue : execTree.getNodes().first)
+    {
+        ASSERT_EQ(keyValue.first, keyValue.second.m_node->getId());
+        ASSERT_TRUE(ids.emplace(keyValue.first).second) << "Node visited twice!";
+    }
+    ASSERT_EQ(ids.size(), 11) << "Wrong node count";
+}
+
+MY_TEST(ExecutionTree_Test, Groups)
+{
+    using IntNode    = DummyNode<Config>;
+    using TreeType   = ExecutionTree<Config>;
+    const int nNodes = 300;
+
+    //! Node recording the order of computation.
+    struct OrderNode : IntNode
+    {
+        using IntNode::IntNode;
+        void compute() override
+        {
+            IntNode::compute();
+            std::scoped_lock<std::mutex> lock(*m_mutex);
+            m_order->emplace_back(this->getId());
+        }
+        std::mutex* m_mutex          = nullptr;
+        std::vector<NodeId>* m_order = nullptr;
+    };
+
+    std::mutex mutex;
+    std::vector<NodeId> order;
+    auto isInGroup = [](NodeId id, TreeType::GroupId groupId) {
+        return groupId == 0 || (groupId <= 3 && id % 3 == groupId - 1) || (groupId == 7 && id % 10 == 0);
+    };
+
+    auto execTree = createRandomTree<TreeType, OrderNode>(nNodes, 1, false, true);
+    for(NodeId id = 0; id < nNodes; ++id)
+    {
+        auto* node    = static_cast<OrderNode*>(execTree->getNode(id));
+        node->m_mutex = &mutex;
+        node->m_order = &order;
+        execTree->addNodeToGroup(id, 1 + id % 3);
+        execTree->addNodeToGroup(id, 1 + id % 3);  // Adding twice has no effect.
+        if(id % 10 == 0)
+        {
+            execTree->addNodeToGroup(id, 7);
+        }
+    }
+    execTree->setup();
+
+    const TreeType& tree = *execTree;
+    ASSERT_EQ(tree.getNodes(7).size(), nNodes / 10) << "Wrong group size";
+    ASSERT_THROW(tree.getNodes(5), Exception);
+    ASSERT_THROW(execTree->runExecute(5), Exception);
+
+    auto priority = [&](NodeId id) { return tree.getNodes().first.find(id)->second.m_priority; };
+
+    for(auto mode : {TreeType::ExecutionMode::Serial, TreeType::ExecutionMode::ParallelLevels})
+    {
+        execTree->setExecutionMode(mode, 4);
+        for(TreeType::GroupId groupId : {0, 1, 2, 3, 7})
+        {
+            order.clear();
+            execTree->runExecute(groupId);
+
+            std::set<NodeId> computed(order.begin(), order.end());
+            ASSERT_EQ(computed.size(), order.size()) << "Node computed twice!";
+            for(NodeId id = 0; id < nNodes; ++id)
+            {
+                ASSERT_EQ(computed.count(id) == 1, isInGroup(id, groupId))
+                    << "Node id: " << id << " wrongly executed in group: " << groupId;
+            }
+            for(std::size_t i = 1; i < order.size(); ++i)
+            {
+                ASSERT_GE(priority(order[i - 1]), priority(order[i])) << "Wrong execution order in group: " << groupId;
+            }
+        }
+    }
+
+    // Removing all nodes of a group removes the group.
+    for(NodeId id = 0; id < nNodes; id += 10)
+    {
+        execTree->removeNode(id);
+    }
+    execTree->setup();
+    ASSERT_THROW(execTree->runExecute(7), Exception);
+    order.clear();
+    execTree->runExecute(1);
+    ASSERT_EQ(order.size(), nNodes / 3 - nNodes / 30) << "Wrong group size after removal";
+}
+
+MY_TEST(ExecutionTree_Test, WriteLinks)
+{
+    using IntNode  = DummyNode<Config>;
+    using TreeType = ExecutionTree<Config>;
+
+    TreeType execTree;
+    execTree.getDefaultOuputPool().setDefaultValue<int>(2);
+    for(NodeId id = 0; id < 4; ++id)
+    {
+        execTree.addNode(std::make_unique<IntNode>(id));
+    }
+    execTree.setNodeClass(0, TreeType::NodeClassification::InputNode);
+    execTree.setNodeClass(2, TreeType::NodeClassification::OutputNode);
+    execTree.setNodeClass(3, TreeType::NodeClassification::OutputNode);
+
+    execTree.setGetLink(0, 0, 1, 0);
+    // Inputs only connected by Write-Links.
+    execTree.addWriteLink(0, 0, 2, 0);
+    execTree.addWriteLink(1, 0, 2, 1);
+    // The Write-Link overrides the Get-Link only when the writer calls `setValue`.
+    execTree.setGetLink(0, 0, 3, 0);
+    execTree.addWriteLink(1, 0, 3, 0);
+    execTree.setup();
+
+    const TreeType& tree = execTree;
+    auto value           = [&](NodeId id) { return tree.getNode(id)->template getOutVal<int>(0); };
+    for(int run = 0; run < 2; ++run)
+    {
+        execTree.runExecute();
+        ASSERT_EQ(value(0), 4) << "wrong result";
+        ASSERT_EQ(value(1), 6) << "wrong result";
+        ASSERT_EQ(value(2), 10) << "wrong result";
+        ASSERT_EQ(value(3), 6) << "Write-Link overrides the Get-Link without `setValue`";
+    }
+
+    // Single writers to inputs without Get-Link: the tree applies the Write-Links.
+    auto batched = [&](NodeId id) { return tree.getNode(id)->template getOSocket<int>(0).isWriteLinksBatched(); };
+    ASSERT_TRUE(batched(0)) << "Write-Links not batched";
+    ASSERT_FALSE(batched(1)) << "Write-Link to an input with a Get-Link batched";
+
+    execTree.getNode(1)->template getOSocket<int>(0).setValue(6);
+    execTree.setup();
+    execTree.runExecute();
+    ASSERT_EQ(value(3), 8) << "Write-Link does not override the Get-Link after `setValue`";
+
+    execTree.removeWriteLink(1, 0, 3, 0);
+    execTree.setup();
+    execTree.runExecute();
+    ASSERT_EQ(value(3), 6) << "Get-Link not restored";
+
+    // Several writers: the last writer in execution order wins.
+    execTree.addWriteLink(0, 0, 2, 1);
+    ASSERT_FALSE(batched(1)) << "Write-Links batched after a change";
+    execTree.setup();
+    ASSERT_FALSE(batched(0) || batched(1)) << "Write-Links to an input with several writers batched";
+    execTree.runExecute();
+    ASSERT_EQ(value(2), 10) << "wrong result";
+}
+
+MY_TEST(ExecutionTree_Test, ValueArena)
+{
+    using IntNode    = DummyNode<Config>;
+    using TreeType   = ExecutionTree<Config>;
+    const int nNodes = 1500;  // More than one chunk.
+
+    TreeType execTree(nullptr, TreeType::ValueLayout::Arena);
+    ASSERT_EQ(execTree.getValueLayout(), TreeType::ValueLayout::Arena);
+    auto& pool                = execTree.getValueArena()->getPool<int>();
+    const std::size_t nValues = pool.getCount();  // Values of the default output pool.
+
+    execTree.getDefaultOuputPool().setDefaultValue<int>(1);
+    for(NodeId id = 0; id < nNodes; ++id)
+    {
+        auto nodeClass = id == 0 ? TreeType::NodeClassification::InputNode
+                                 : (id == nNodes - 1 ? TreeType::NodeClassification::OutputNode
+                                                     : TreeType::NodeClassification::NormalNode);
+        execTree.addNode(execTree.createNode<IntNode>(id), nodeClass);
+        if(id > 0)
+        {
+            execTree.setGetLink(id - 1, 0, id, 0);
+        }
+    }
+    ASSERT_EQ(pool.getCount(), nValues + nNodes) << "values not allocated in the arena";
+    ASSERT_EQ(pool.getChunkCount(), 2);
+
+    execTree.setup();
+    execTree.runExecute();
+
+    // Node `i` computes `i + 2`, the default value is `1`.
+    long long sum = 0;
+    pool.forEach([&](int value) { sum += value; });
+    ASSERT_EQ(sum, 1 + (long long)nNodes * (nNodes + 3) / 2) << "wrong values in the arena";
+
+    // Removed nodes free their values, new nodes reuse them.
+    const std::size_t nSlots = pool.getSlotCount();
+    execTree.removeNode(nNodes - 1);
+    ASSERT_EQ(pool.getCount(), nValues + nNodes - 1);
+    execTree.addNode(execTree.createNode<IntNode>(nNodes - 1), TreeType::NodeClassification::OutputNode);
+    ASSERT_EQ(pool.getSlotCount(), nSlots) << "slot not reused";
+
+    TreeType perSocket;
+    ASSERT_EQ(perSocket.getValueArena(), nullptr);
+
+    // Without arena the values are stored inline in their sockets.
+    auto node          = perSocket.createNode<IntNode>(0);
+    const auto& socket = node->template getOSocket<int>(0);
+    auto* value        = reinterpret_cast<const char*>(&socket.getValue());
+    std::less<const char*> less;
+    ASSERT_TRUE(!less(value, reinterpret_cast<const char*>(&socket)) && less(value, reinterpret_cast<const char*>(&socket + 1)))
+        << "value not stored inline";
+}
+
+MY_TEST(ExecutionTree_Test, ValueSnapshots)
+{
+    using IntNode    = DummyNode<Config>;
+    using TreeType   = ExecutionTree<Config>;
+    const int nNodes = 300;
+
+    auto execTree        = createRandomTree<TreeType, IntNode>(nNodes, 1, false, false);
+    const TreeType& tree = *execTree;
+    auto values          = [&]() {
+        std::vector<int> v;
+        for(NodeId id = 0; id < nNodes; ++id)
+        {
+            v.emplace_back(tree.getNode(id)->template getOutVal<int>(0));
+        }
+        return v;
+    };
+
+    execTree->getDefaultOuputPool().setDefaultValue<std::string>("A");
+    execTree->runExecute();
+    const std::vector<int> values0 = values();
+    SocketValueSnapshot full;
+    execTree->captureValues(full);
+    ASSERT_FALSE(full.isDelta());
+
+    // Only the input nodes change.
+    for(auto* node : tree.getNodes(TreeType::NodeClassification::InputNode))
+    {
+        node->template getOutVal<int>(0) += 1;
+    }
+    execTree->getDefaultOuputPool().setDefaultValue<std::string>("BB");
+    const std::vector<int> values1 = values();
+    SocketValueSnapshot delta;
+    execTree->captureValues(delta, true);
+    ASSERT_TRUE(delta.isDelta());
+    ASSERT_EQ(delta.getHeader().m_nodeCount, tree.getNodes(TreeType::NodeClassification::InputNode).size() + 1)
+        << "delta snapshot contains unchanged nodes";
+    ASSERT_LT(delta.getSize(), full.getSize());
+
+    SocketValueSnapshot empty;
+    execTree->captureValues(empty, true);
+    ASSERT_EQ(empty.getHeader().m_nodeCount, 0) << "nothing changed since the last capture";
+
+    execTree->restoreValues(full);
+    ASSERT_EQ(values(), values0) << "full snapshot not restored";
+    ASSERT_EQ(execTree->getDefaultOuputPool().getOutVal<std::string>(meta::find_index<Config::SocketTypes, std::string>::value), "A");
+
+    execTree->restoreValues(delta);
+    ASSERT_EQ(values(), values1) << "delta snapshot not restored";
+    ASSERT_EQ(execTree->getDefaultOuputPool().getOutVal<std::string>(meta::find_index<Config::SocketTypes, std::string>::value), "BB");
+
+    // Corrupted snapshots are detected.
+    auto bytes = full.getData();
+    bytes.pop_back();
+    ASSERT_THROW(execTree->restoreValues(SocketValueSnapshot(bytes)), Exception);
+    TreeType other;
+    ASSERT_THROW(other.restoreValues(full), Exception);
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -56,6 +56,150 @@ MY_TEST(Node_Test, Int_Int2)
     ASSERT_EQ(node2.getConnectedOutputCount(), 0) << "Connected input count wrong";
 }
 
+MY_TEST(Node_Test, LinkBookkeeping)
+{
+    using Node = DummyNode<Config>;
+
+    // More links than the inline capacity of the socket link lists.
+    Node dst(0);
+    std::vector<std::unique_ptr<Node>> writers;
+    for(NodeId id = 1; id <= 4; ++id)
+    {
+        writers.emplace_back(std::make_unique<Node>(id));
+        writers.back()->addWriteLink(0, dst, 0);
+    }
+    ASSERT_EQ(dst.getISocket(0).getConnectionCount(), 4) << "Wrong writer count";
+
+    writers[1]->getOSocket(0).removeWriteLink(dst.getISocket(0));
+    writers[3] = nullptr;  // Destruction removes the Write-Link.
+    ASSERT_EQ(dst.getISocket(0).getConnectionCount(), 2) << "Wrong writer count";
+    const auto& writing = dst.getISocket(0).getWritingSockets();
+    ASSERT_EQ(writing[0], &writers[0]->getOSocket(0)) << "Wrong writer order";
+    ASSERT_EQ(writing[1], &writers[2]->getOSocket(0)) << "Wrong writer order";
+
+    // Get-Links: one output with many getters.
+    auto src = std::make_unique<Node>(10);
+    std::vector<std::unique_ptr<Node>> getters;
+    for(NodeId id = 11; id <= 14; ++id)
+    {
+        getters.emplace_back(std::make_unique<Node>(id));
+        getters.back()->setGetLink(*src, 0, 1);
+    }
+    ASSERT_EQ(src->getOSocket(0).getConnectionCount(), 4) << "Wrong getter count";
+
+    // Write-Link to an input which already gets from this output is not allowed.
+    ASSERT_THROW(src->addWriteLink(0, *getters[0], 1), NodeConnectionException);
+
+    getters[0]->getISocket(1).removeGetLink();
+    getters[2] = nullptr;
+    ASSERT_EQ(src->getOSocket(0).getConnectionCount(), 2) << "Wrong getter count";
+
+    // Destruction of the output resets the Get-Links.
+    src = nullptr;
+    ASSERT_FALSE(getters[1]->getISocket(1).hasGetLink()) << "Get-Link not removed";
+    ASSERT_FALSE(getters[3]->getISocket(1).hasGetLink()) << "Get-Link not removed";
+}
+
+MY_TEST(Node_Test, SocketHandles)
+{
+    using Node = DummyNode<Config>;
+    Node node1(1);
+    Node node2(2);
+    node1.addWriteLink(0, node2, 0);
+    node1.addWriteLink(0, node2, 1);
+
+    // Types are checked once when binding.
+    ASSERT_THROW(node2.bindInput<double>(0), BadSocketCastException);
+    ASSERT_THROW(node1.bindOutput<std::string>(0), BadSocketCastException);
+    ASSERT_THROW(node2.bindInput<int>(2), Exception);
+
+    Node::InputHandle<int> value1  = node2.bindIn<Node::Value1>();
+    Node::InputHandle<int> value2  = node2.bindInput<int>(1);
+    Node::OutputHandle<int> result = node2.bindOut<Node::Result1>();
+    ASSERT_TRUE(value1.isBound() && value2.isBound() && result.isBound());
+
+    node1.bindOutput<int>(0).setValue(3);
+    ASSERT_EQ(*value1, 3) << "Wrong input value";
+    ASSERT_EQ(value2.getValue(), 3) << "Wrong input value";
+
+    node2.compute();
+    ASSERT_EQ(*result, 6) << "Wrong output value";
+    *result = 1;
+    ASSERT_EQ(node2.getOutVal<Node::Result1>(), 1) << "Handle does not refer to the socket value";
+}
+
+//! Node whose sockets do not match its socket declarations.
+class MismatchNode : public Config::NodeBaseType
+{
+public:
+    enum Ins
+    {
+        Value
+    };
+    enum Outs
+    {
+        Result
+    };
+    EXECGRAPH_DEFINE_SOCKET_TRAITS(Ins, Outs)
+
+    using InSockets  = InSocketDeclList<InSocketDecl<Value, double>>;
+    using OutSockets = OutSocketDeclList<OutSocketDecl<Result, double>>;
+
+    EXECGRAPH_DEFINE_LOGIC_NODE_VALUE_GETTERS(Ins, InSockets, Outs, OutSockets)
+
+    MismatchNode(NodeId id)
+        : Config::NodeBaseType(id)
+    {
+        this->template addISock<int>();
+        this->template addOSock<int>(0);
+    }
+
+    void reset() override {}
+    void compute() override {}
+};
+
+MY_TEST(Node_Test, SocketDeclarationTypes)
+{
+    // The declaration getters check the type of the socket.
+    MismatchNode node(1);
+    if(throwIfBadSocketCast)
+    {
+        ASSERT_THROW(node.getOutVal<MismatchNode::Result>(), BadSocketCastException);
+        ASSERT_THROW(node.getInVal<MismatchNode::Value>(), BadSocketCastException);
+    }
+}
+
+MY_TEST(Node_Test, SocketVisitor)
+{
+    using Node = DummyNode<Config>;
+    Node node(1);
+
+    // The visitor is called with the typed socket.
+    auto typeIndex = [](auto& socket) {
+        using Socket = std::decay_t<decltype(socket)>;
+        return meta::find_index<Config::SocketTypes, typename Socket::DataType>::value;
+    };
+    const IndexType intIndex = meta::find_index<Config::SocketTypes, int>::value;
+    ASSERT_EQ(node.getISocket(0).applyVisitor(typeIndex), intIndex);
+    ASSERT_EQ(node.getOSocket(0).applyVisitor(typeIndex), intIndex);
+
+    const Node& cnode = node;
+    auto index        = cnode.getOSocket(0).applyVisitor([](auto& socket) {
+        static_assert(std::is_const<std::remove_reference_t<decltype(socket)>>::value, "Socket should be const");
+        return socket.getIndex();
+    });
+    ASSERT_EQ(index, 0) << "Wrong socket visited";
+
+    node.getOSocket(0).applyVisitor([](auto& socket) {
+        using Socket = std::decay_t<decltype(socket)>;
+        if constexpr(std::is_same<typename Socket::DataType, int>::value)
+        {
+            socket.setValue(4);
+        }
+    });
+    ASSERT_EQ(node.getOSocket<int>(0).getValue(), 4) << "Visitor did not set the value";
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -11,12 +11,19 @@
 //! ========================================================================================
 
 #include <array>
+#include <fstream>
+#include <numeric>
 #include "TestFunctions.hpp"
+#include "executionGraph/common/BoundedTaskQueue.hpp"
+#include "executionGraph/common/CpuTopology.hpp"
 #include "executionGraph/common/Exception.hpp"
 #include "executionGraph/common/IObjectID.hpp"
+#include "executionGraph/common/NumaThreadPool.hpp"
+#include "executionGraph/common/PriorityTaskQueue.hpp"
 #include "executionGraph/common/TaskConsumer.hpp"
 #include "executionGraph/common/TaskQueue.hpp"
 #include "executionGraph/common/ThreadPool.hpp"
+#include "executionGraph/common/WorkStealingThreadPool.hpp"
 
 #ifdef __clang__
 #    pragma clang diagnostic push
@@ -220,6 +227,582 @@ MY_TEST(TaskQueue, MovableTasksOnly)
     q.emplace(3);
 }
 
+MY_TEST(TaskQueue, CloseWakesConsumers)
+{
+    TaskQueue<int> q;
+    std::atomic<int> woken = 0;
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]() {
+            // Blocks until closed.
+            EXECGRAPH_THROW_IF(q.popBlocking(), "Closed queue should not return a task!");
+            ++woken;
+        });
+    }
+
+    std::this_thread::sleep_for(50ms);
+    ASSERT_EQ(woken, 0) << "Consumers should block on an empty queue!";
+    q.close();
+    for(auto& t : threads)
+    {
+        t.join();
+    }
+    ASSERT_EQ(woken, 4);
+
+    // Tasks stay in a closed queue until it is opened again.
+    q.emplace(1);
+    ASSERT_FALSE(q.pop(0ms));
+    q.open();
+    ASSERT_EQ(q.pop(), 1);
+}
+
+MY_TEST(TaskQueue, Bulk)
+{
+    TaskQueue<std::unique_ptr<int>> q;
+
+    std::vector<std::unique_ptr<int>> tasks;
+    for(int i = 0; i < 10; ++i)
+    {
+        tasks.emplace_back(std::make_unique<int>(i));
+    }
+    q.emplaceBulk(std::move(tasks));
+
+    auto popped = q.popBulk(4);
+    ASSERT_EQ(popped.size(), 4);
+    ASSERT_EQ(q.popBulk(popped, 100), 6);
+    ASSERT_EQ(popped.size(), 10);
+    for(int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(*popped[i], i) << "Order not preserved!";
+    }
+
+    // Copying from an lvalue range.
+    TaskQueue<int> qi;
+    std::vector<int> values = {1, 2, 3};
+    qi.emplaceBulk(values);
+    ASSERT_EQ(values.size(), 3);
+    ASSERT_EQ(qi.popBulk(10), values);
+
+    // A whole batch wakes up all waiting consumers.
+    std::atomic<int> count = 0;
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]() {
+            std::vector<int> batch;
+            while(qi.popBulk(batch, 8))
+            {
+                count += int(batch.size());
+                batch.clear();
+            }
+        });
+    }
+    qi.emplaceBulk(std::vector<int>(1000, 1));
+    for(int i = 0; i < 1000 && count != 1000; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    qi.close();
+    for(auto& t : threads)
+    {
+        t.join();
+    }
+    ASSERT_EQ(count, 1000);
+}
+
+MY_TEST(BoundedTaskQueue, Backpressure)
+{
+    BoundedTaskQueue<std::unique_ptr<int>> q(3);
+    ASSERT_EQ(q.getCapacity(), 4);
+
+    for(int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(q.tryEmplace(std::make_unique<int>(i)));
+    }
+    auto task = std::make_unique<int>(4);
+    ASSERT_FALSE(q.tryEmplace(std::move(task))) << "Full queue should not accept tasks!";
+    ASSERT_TRUE(task) << "Rejected task should not be consumed!";
+    ASSERT_EQ(q.size(), 4);
+
+    // Blocking push waits until a consumer makes space.
+    std::atomic<bool> pushed = false;
+    std::thread producer([&]() {
+        q.emplace(std::move(task));
+        pushed = true;
+    });
+    std::this_thread::sleep_for(50ms);
+    ASSERT_FALSE(pushed) << "Producer should block on a full queue!";
+
+    for(int i = 0; i < 5; ++i)
+    {
+        auto t = q.pop();
+        ASSERT_TRUE(t);
+        ASSERT_EQ(**t, i) << "Order not preserved!";
+    }
+    producer.join();
+    ASSERT_TRUE(pushed);
+    ASSERT_FALSE(q.pop(0ms));
+
+    // Closing wakes up blocked consumers and producers.
+    std::thread consumer([&]() { EXECGRAPH_THROW_IF(q.popBlocking(), "Closed queue should not return a task!"); });
+    std::this_thread::sleep_for(10ms);
+    q.close();
+    consumer.join();
+
+    q.open();
+    for(int i = 0; i < 4; ++i)
+    {
+        q.emplace(std::make_unique<int>(i));
+    }
+    std::thread blockedProducer([&]() { EXECGRAPH_THROW_IF(q.emplace(std::make_unique<int>(5)), "Closed full queue should drop the task!"); });
+    std::this_thread::sleep_for(10ms);
+    q.close();
+    blockedProducer.join();
+    ASSERT_EQ(q.size(), 4);
+}
+
+MY_TEST(BoundedTaskQueue, MPMC)
+{
+    const int nProducers = 4;
+    const int nTasks     = 20000;
+
+    BoundedTaskQueue<int> q(64);
+    std::atomic<long> sum  = 0;
+    std::atomic<int> count = 0;
+
+    std::vector<std::thread> consumers;
+    for(int c = 0; c < 4; ++c)
+    {
+        consumers.emplace_back([&, c]() {
+            std::vector<int> batch;
+            while(true)
+            {
+                batch.clear();
+                // Mix single and bulk pops.
+                if(c % 2 == 0)
+                {
+                    auto t = q.popBlocking();
+                    if(!t)
+                    {
+                        break;
+                    }
+                    batch.push_back(*t);
+                }
+                else if(q.popBulk(batch, 8) == 0)
+                {
+                    break;
+                }
+                for(int v : batch)
+                {
+                    sum += v;
+                }
+                count += int(batch.size());
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for(int p = 0; p < nProducers; ++p)
+    {
+        producers.emplace_back([&, p]() {
+            if(p % 2 == 0)
+            {
+                for(int i = 1; i <= nTasks; ++i)
+                {
+                    q.emplace(i);
+                }
+            }
+            else
+            {
+                std::vector<int> values(nTasks);
+                std::iota(values.begin(), values.end(), 1);
+                EXECGRAPH_THROW_IF(q.emplaceBulk(values) != nTasks, "Not all tasks emplaced!");
+            }
+        });
+    }
+    for(auto& t : producers)
+    {
+        t.join();
+    }
+    for(int i = 0; i < 5000 && count != nProducers * nTasks; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    q.close();
+    for(auto& t : consumers)
+    {
+        t.join();
+    }
+
+    ASSERT_EQ(count, nProducers * nTasks);
+    ASSERT_EQ(sum, long(nProducers) * nTasks * (nTasks + 1) / 2);
+}
+
+MY_TEST(ProducerConsumer, BoundedThreadPool)
+{
+    struct CountTask
+    {
+        CountTask(std::atomic<int>& count)
+            : m_count(&count) {}
+        void runTask(std::thread::id) { ++*m_count; }
+        void onTaskException(std::exception_ptr) {}
+        std::atomic<int>* m_count;
+    };
+
+    std::atomic<int> count = 0;
+    ThreadPool<CountTask, BoundedTaskQueue<CountTask>> pool(4, 16);
+    ASSERT_EQ(pool.getQueue()->getCapacity(), 16);
+
+    pool.start();
+    for(int i = 0; i < 1000; ++i)
+    {
+        pool.getQueue()->emplace(count);
+    }
+    for(int i = 0; i < 1000 && count != 1000; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    pool.join();
+    ASSERT_EQ(count, 1000);
+}
+
+MY_TEST(PriorityTaskQueue, Scheduling)
+{
+    struct A
+    {
+        A(int a)
+            : b(a) {}
+        A(A&& a) = default;
+        const int b;  // not assignable
+    };
+
+    PriorityTaskQueue<A> q;
+    auto now = TaskSchedule::Clock::now();
+
+    q.emplaceScheduled(TaskSchedule(TaskPriority::Low), 0);
+    q.emplace(1);
+    q.emplaceScheduled(TaskSchedule(TaskPriority::Low, now + 1s), 2);
+    q.emplaceScheduled(TaskSchedule(TaskPriority::High), 3);
+    q.emplace(4);
+    q.emplaceScheduled(TaskSchedule(TaskPriority::High, now + 2s), 5);
+    q.emplaceScheduled(TaskSchedule::withTimeout(TaskPriority::High, 1s), 6);
+    ASSERT_EQ(q.size(), 7);
+
+    // Priority class first, then earliest deadline first, then FIFO.
+    std::vector<int> expected = {6, 5, 3, 1, 4, 2, 0};
+    std::vector<A> tasks;
+    ASSERT_EQ(q.popBulk(tasks, 2), 2);
+    for(int i = 2; i < 7; ++i)
+    {
+        tasks.emplace_back(*q.pop());
+    }
+    for(int i = 0; i < 7; ++i)
+    {
+        ASSERT_EQ(tasks[i].b, expected[i]) << "Wrong schedule at position " << i;
+    }
+    ASSERT_FALSE(q.pop(0ms));
+}
+
+MY_TEST(ProducerConsumer, PriorityThreadPool)
+{
+    struct OrderTask
+    {
+        OrderTask(int id, std::vector<int>& order)
+            : m_id(id), m_order(&order) {}
+        void runTask(std::thread::id)
+        {
+            std::this_thread::sleep_for(1ms);
+            m_order->push_back(m_id);
+        }
+        void onTaskException(std::exception_ptr) {}
+        int m_id;
+        std::vector<int>* m_order;
+    };
+
+    std::vector<int> order;
+    ThreadPool<OrderTask, PriorityTaskQueue<OrderTask>> pool(1);
+    auto& q = pool.getQueue();
+
+    // Interactive tasks overtake queued bulk tasks.
+    for(int i = 0; i < 5; ++i)
+    {
+        q->emplaceScheduled(TaskSchedule(TaskPriority::Low), i, order);
+    }
+    q->emplaceScheduled(TaskSchedule(TaskPriority::High), 100, order);
+
+    pool.start();
+    for(int i = 0; i < 1000 && q->size() != 0; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    std::this_thread::sleep_for(10ms);
+    pool.join();
+
+    ASSERT_EQ(order, (std::vector<int>{100, 0, 1, 2, 3, 4}));
+}
+
+MY_TEST(CpuTopology, Discover)
+{
+    ASSERT_EQ(CpuTopology::parseCpuList("0-3,8, 10-11\n"), (std::vector<std::size_t>{0, 1, 2, 3, 8, 10, 11}));
+    ASSERT_EQ(CpuTopology::parseCpuList(""), std::vector<std::size_t>{});
+    ASSERT_THROW(CpuTopology::parseCpuList("3-1"), Exception);
+    ASSERT_THROW(CpuTopology::parseCpuList("a-1"), Exception);
+
+    // Invalid topologies.
+    ASSERT_THROW(CpuTopology({}), Exception);
+    ASSERT_THROW(CpuTopology({{0, {0, 1}}, {1, {}}}), Exception);
+
+    // Fake sysfs with two nodes and a memory-only node.
+    auto dir = std::filesystem::temp_directory_path() / "executionGraph-CpuTopology";
+    std::filesystem::remove_all(dir);
+    auto writeNode = [&](const std::string& name, const std::string& cpuList) {
+        std::filesystem::create_directories(dir / name);
+        std::ofstream(dir / name / "cpulist") << cpuList << "\n";
+    };
+    writeNode("node1", "4-7");
+    writeNode("node0", "0-3");
+    writeNode("node2", "");
+    std::filesystem::create_directories(dir / "power");
+
+    auto topology = CpuTopology::discover(dir);
+    std::filesystem::remove_all(dir);
+    ASSERT_EQ(topology.getNodeCount(), 2);
+    ASSERT_EQ(topology.getNodes()[0].m_id, 0);
+    ASSERT_EQ(topology.getNodes()[1].m_cpus, (std::vector<std::size_t>{4, 5, 6, 7}));
+    ASSERT_EQ(topology.getCpuCount(), 8);
+
+    // Fallback to a single node.
+    auto fallback = CpuTopology::discover(dir);
+    ASSERT_EQ(fallback.getNodeCount(), 1);
+    ASSERT_GE(fallback.getCpuCount(), 1);
+
+    // This machine.
+    auto machine = CpuTopology::discover();
+    ASSERT_GE(machine.getNodeCount(), 1);
+    ASSERT_TRUE(setCurrentThreadAffinity(machine.getCpusByNode()));
+}
+
+MY_TEST(ProducerConsumer, PinnedThreadPool)
+{
+    struct CountTask
+    {
+        CountTask(std::atomic<int>& count)
+            : m_count(&count) {}
+        void runTask(std::thread::id) { ++*m_count; }
+        void onTaskException(std::exception_ptr) {}
+        std::atomic<int>* m_count;
+    };
+
+    auto topology          = CpuTopology::discover();
+    std::atomic<int> count = 0;
+    ThreadPool<CountTask> pool(3);
+    pool.pinThreadsToCpus(topology);
+    pool.start();
+    for(int i = 0; i < 100; ++i)
+    {
+        pool.getQueue()->emplace(count);
+    }
+    for(int i = 0; i < 1000 && count != 100; ++i)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    pool.join();
+    ASSERT_EQ(count, 100);
+
+    pool.pinThreadsToNodes(topology);
+    pool.start();
+    pool.join();
+}
+
+MY_TEST(ProducerConsumer, NumaThreadPool)
+{
+    struct NodeTask
+    {
+        using Pool = NumaThreadPool<NodeTask>;
+
+        NodeTask(Pool& pool, int depth, std::size_t node, std::atomic<int>& executed, std::atomic<int>& local)
+            : m_pool(&pool), m_depth(depth), m_node(node), m_executed(&executed), m_local(&local) {}
+
+        void runTask(std::thread::id)
+        {
+            ++*m_executed;
+            if(*m_pool->getCurrentNodeIndex() == m_node)
+            {
+                ++*m_local;
+            }
+            if(m_depth > 0)
+            {
+                // Follow-up tasks stay on the node of this worker.
+                std::size_t node = *m_pool->getCurrentNodeIndex();
+                m_pool->emplace(*m_pool, m_depth - 1, node, *m_executed, *m_local);
+                m_pool->emplace(*m_pool, m_depth - 1, node, *m_executed, *m_local);
+            }
+        }
+
+        void onTaskException(std::exception_ptr e) {}
+
+        Pool* m_pool;
+        int m_depth;
+        std::size_t m_node;
+        std::atomic<int>* m_executed;
+        std::atomic<int>* m_local;
+    };
+
+    // Two (fake) nodes on the CPUs of this machine.
+    auto cpus = CpuTopology::discover().getCpusByNode();
+    CpuTopology topology({{0, cpus}, {1, cpus}});
+
+    std::atomic<int> executed = 0;
+    std::atomic<int> local    = 0;
+    const int depth           = 8;
+
+    NodeTask::Pool pool(topology, 2);
+    ASSERT_EQ(pool.getNodeCount(), 2);
+    ASSERT_EQ(pool.getThreadCount(), 4);
+    ASSERT_FALSE(pool.getCurrentNodeIndex());
+
+    pool.start();
+    pool.emplaceOnNode(0, pool, depth, 0, executed, local);
+    pool.emplaceOnNode(1, pool, depth, 1, executed, local);
+
+    const int nTasks = 2 * ((1 << (depth + 1)) - 1);
+    for(int i = 0; i < 1000 && executed != nTasks; ++i)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    pool.join();
+
+    ASSERT_EQ(executed, nTasks) << "Not all tasks executed!";
+    ASSERT_GT(local, 0) << "No task executed on its preferred node!";
+}
+
+MY_TEST(ProducerConsumer, FastJoin)
+{
+    struct CountTask
+    {
+        CountTask(std::atomic<int>& count)
+            : m_count(&count) {}
+        void runTask(std::thread::id) { ++*m_count; }
+        void onTaskException(std::exception_ptr) {}
+        std::atomic<int>* m_count;
+    };
+
+    std::atomic<int> count = 0;
+    ThreadPool<CountTask> pool(16);
+
+    for(int l = 0; l < 3; ++l)
+    {
+        pool.start();
+        for(int i = 0; i < 100; ++i)
+        {
+            pool.getQueue()->emplace(count);
+        }
+        for(int i = 0; i < 1000 && count != 100 * (l + 1); ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        ASSERT_EQ(count, 100 * (l + 1)) << "Not all tasks executed!";
+
+        // Idle consumers are woken up right away (no polling).
+        auto start = std::chrono::steady_clock::now();
+        pool.join();
+        ASSERT_LT(std::chrono::steady_clock::now() - start, 100ms) << "Joining idle consumers is too slow!";
+    }
+
+    // A single consumer is woken up by its own join.
+    using Consumer = TaskConsumer<TaskQueue<CountTask>>;
+    Consumer consumer(std::make_shared<TaskQueue<CountTask>>());
+    consumer.start();
+    std::this_thread::sleep_for(10ms);
+    auto start = std::chrono::steady_clock::now();
+    consumer.join();
+    ASSERT_LT(std::chrono::steady_clock::now() - start, 100ms) << "Joining an idle consumer is too slow!";
+
+    // A busy consumer stops after its current task, the remaining tasks stay in the queue.
+    struct SlowTask
+    {
+        SlowTask(std::atomic<int>& count)
+            : m_count(&count) {}
+        void runTask(std::thread::id)
+        {
+            std::this_thread::sleep_for(1ms);
+            ++*m_count;
+        }
+        void onTaskException(std::exception_ptr) {}
+        std::atomic<int>* m_count;
+    };
+
+    std::atomic<int> slowCount = 0;
+    auto slowQueue             = std::make_shared<TaskQueue<SlowTask>>();
+    TaskConsumer<TaskQueue<SlowTask>> slowConsumer(slowQueue);
+    for(int i = 0; i < 1000; ++i)
+    {
+        slowQueue->emplace(slowCount);
+    }
+    slowConsumer.start();
+    std::this_thread::sleep_for(10ms);
+    slowConsumer.join();
+    ASSERT_LT(slowCount, 1000) << "Join did not stop the consumer before the queue was drained!";
+    ASSERT_TRUE(slowQueue->pop(0ms)) << "Remaining tasks should stay in the queue!";
+}
+
+MY_TEST(ProducerConsumer, WorkStealing)
+{
+    struct SpawnTask
+    {
+        using Pool = WorkStealingThreadPool<SpawnTask>;
+
+        SpawnTask(Pool& pool, int depth, std::atomic<int>& executed, std::atomic<int>& failed)
+            : m_pool(&pool), m_depth(depth), m_executed(&executed), m_failed(&failed) {}
+
+        void runTask(std::thread::id threadId)
+        {
+            ++*m_executed;
+            if(m_depth > 0)
+            {
+                // Spawn two follow-up tasks into the local deque.
+                m_pool->emplace(*m_pool, m_depth - 1, *m_executed, *m_failed);
+                m_pool->emplace(*m_pool, m_depth - 1, *m_executed, *m_failed);
+            }
+            else
+            {
+                EXECGRAPH_THROW("Leaf task failed for test!");
+            }
+        }
+
+        void onTaskException(std::exception_ptr e)
+        {
+            ++*m_failed;
+        }
+
+        Pool* m_pool;
+        int m_depth;
+        std::atomic<int>* m_executed;
+        std::atomic<int>* m_failed;
+    };
+
+    std::atomic<int> executed = 0;
+    std::atomic<int> failed   = 0;
+    const int depth           = 12;
+
+    SpawnTask::Pool pool(4);
+    pool.start();
+    pool.emplace(pool, depth, executed, failed);
+
+    const int nLeafs = 1 << depth;
+    const int nTasks = (nLeafs << 1) - 1;
+    for(int i = 0; i < 1000 && failed != nLeafs; ++i)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    pool.join();
+
+    ASSERT_EQ(executed, nTasks) << "Not all tasks executed!";
+    ASSERT_EQ(failed, nLeafs) << "Not all leaf tasks reported their exception!";
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);